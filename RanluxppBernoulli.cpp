@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "RanluxppBernoulli.h"
+#include "RanluxppEngine.h"
+
+#include <cassert>
+#include <cmath>
+#include <cstdint>
+
+RanluxppBernoulli::RanluxppBernoulli(double p, int bits) : fBits(bits) {
+  assert(p >= 0 && p <= 1 && "probability out of range!");
+  assert(bits >= 1 && bits <= 63 && "number of bits out of range!");
+
+  fP = static_cast<uint64_t>(std::floor(std::ldexp(p, bits) + 0.5));
+  fLast = 0;
+  while (fLast < bits && !((fP >> fLast) & 1)) {
+    fLast++;
+  }
+}
+
+double RanluxppBernoulli::Probability() const {
+  return std::ldexp(static_cast<double>(fP), -fBits);
+}
+
+uint64_t RanluxppBernoulli::Mask(RanluxppEngine &rng) const {
+  return MaskFrom([&rng]() { return rng.NextBits(64); });
+}
+
+void RanluxppBernoulli::Fill(RanluxppEngine &rng, uint64_t *masks,
+                             size_t n) const {
+  for (size_t i = 0; i < n; i++) {
+    masks[i] = Mask(rng);
+  }
+}
@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RanluxppBernoulli_h
+#define RanluxppBernoulli_h
+
+#include <cstddef>
+#include <cstdint>
+
+class RanluxppEngine;
+
+/// Generator of packed Bernoulli(p) decisions, 64 in each mask
+///
+/// The probability is rounded to `bits` binary digits, p = P / 2 ** bits, and
+/// each bit of a mask is set with exactly that probability. Instead of drawing
+/// one number per decision, the 64 decisions of a mask compare 64 uniform
+/// numbers U against P in parallel: the bits of U are generated from the most
+/// significant one, one random word for all lanes at a time, until every lane
+/// is decided or the last set bit of P is reached. For p = 1/2 this needs
+/// exactly one word per mask, or one random bit per decision. In general, a
+/// mask needs at most as many words as P has binary digits up to its last set
+/// bit, and on average less than 7.5 (when all 64 lanes are decided).
+class RanluxppBernoulli final {
+
+private:
+  uint64_t fP; ///< Numerator of the probability P / 2 ** fBits
+  int fBits;   ///< Number of binary digits of the probability
+  int fLast;   ///< Index of the lowest set bit of fP
+
+public:
+  /// Round the probability `p` in [0, 1] to `bits` binary digits, up to 63
+  RanluxppBernoulli(double p, int bits = 32);
+
+  /// The exact probability that a bit in a mask is set
+  double Probability() const;
+
+  /// Generate a mask with the next random bits of the engine
+  uint64_t Mask(RanluxppEngine &rng) const;
+  /// Fill `masks` with `n` masks, for 64 * `n` decisions
+  void Fill(RanluxppEngine &rng, uint64_t *masks, size_t n) const;
+
+  /// Generate a mask from random words returned by `next()`
+  template <class NextWord> uint64_t MaskFrom(NextWord &&next) const {
+    if (fP == 0) {
+      return 0;
+    } else if (fP == (uint64_t(1) << fBits)) {
+      return ~uint64_t(0);
+    }
+
+    // For each lane: set if a bit of U is 0 where P has a 1 (U < P), cleared
+    // if it is 1 where P has a 0 (U > P), and undecided otherwise.
+    uint64_t mask = 0;
+    uint64_t undecided = ~uint64_t(0);
+    for (int j = fBits - 1; j >= fLast && undecided != 0; j--) {
+      uint64_t word = next();
+      if ((fP >> j) & 1) {
+        mask |= undecided & ~word;
+        undecided &= word;
+      } else {
+        undecided &= ~word;
+      }
+    }
+    // Lanes still undecided have U >= P, because all further bits of P are 0.
+    return mask;
+  }
+};
+
+#endif // RanluxppBernoulli_h
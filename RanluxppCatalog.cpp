@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+/** \class RanluxppCatalog
+Catalog of precomputed substream states for RanluxppEngine
+
+Seeding an engine and skipping to the start of its substream requires several
+calls to powermod. For large campaigns with thousands of jobs, the states can
+instead be computed once with RanluxppCatalog::Build (or the command line tool
+`ranluxpp_catalog`) and stored in a file with fixed-size records. Each job then
+maps the file into memory and copies its record into an engine.
+*/
+
+#include "RanluxppCatalog.h"
+
+#include "ranluxpp/ranlux_lcg.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+const char kMagic[8] = {'R', 'L', 'X', 'P', 'P', 'C', 'A', 'T'};
+constexpr uint32_t kVersion = 2;
+constexpr uint64_t kNumbers = 12;
+
+static_assert(sizeof(RanluxppCatalogHeader) == 56, "unexpected header size");
+static_assert(sizeof(RanluxppCatalogRecord) == 80, "unexpected record size");
+
+constexpr uint64_t kFNVOffsetBasis = 0xcbf29ce484222325;
+constexpr uint64_t kFNVPrime = 0x100000001b3;
+
+/// Update the FNV-1a hash `hash` with `size` bytes starting at `data`
+uint64_t fnv1a(uint64_t hash, const void *data, size_t size) {
+  const unsigned char *bytes = static_cast<const unsigned char *>(data);
+  for (size_t i = 0; i < size; i++) {
+    hash ^= bytes[i];
+    hash *= kFNVPrime;
+  }
+  return hash;
+}
+
+/// Hash the header with a zero checksum
+uint64_t hashHeader(const RanluxppCatalogHeader &header) {
+  RanluxppCatalogHeader copy = header;
+  copy.checksum = 0;
+  return fnv1a(kFNVOffsetBasis, &copy, sizeof(copy));
+}
+
+} // end anonymous namespace
+
+RanluxppCatalog::RanluxppCatalog(const char *path) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+
+  struct stat st;
+  if (fstat(fd, &st) != 0 ||
+      static_cast<size_t>(st.st_size) < sizeof(RanluxppCatalogHeader)) {
+    close(fd);
+    return;
+  }
+
+  size_t size = st.st_size;
+  void *mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+  // The mapping stays valid after closing the file descriptor.
+  close(fd);
+  if (mapping == MAP_FAILED) {
+    return;
+  }
+
+  const RanluxppCatalogHeader *header =
+      static_cast<const RanluxppCatalogHeader *>(mapping);
+  bool valid = std::memcmp(header->magic, kMagic, sizeof(kMagic)) == 0;
+  valid &= header->version == kVersion;
+  valid &= header->recordSize == sizeof(RanluxppCatalogRecord);
+  size_t available = size - sizeof(RanluxppCatalogHeader);
+  valid &= available % sizeof(RanluxppCatalogRecord) == 0;
+  valid &= header->count == available / sizeof(RanluxppCatalogRecord);
+  if (valid) {
+    // The engine indexes its numbers with the position, reject records that
+    // could not have been written by Build.
+    const RanluxppCatalogRecord *records =
+        reinterpret_cast<const RanluxppCatalogRecord *>(header + 1);
+    for (uint64_t i = 0; valid && i < header->count; i++) {
+      valid = records[i].position <= kNumbers;
+    }
+  }
+  if (!valid) {
+    munmap(mapping, size);
+    return;
+  }
+
+  fHeader = header;
+  fRecords = reinterpret_cast<const RanluxppCatalogRecord *>(header + 1);
+  fSize = size;
+}
+
+RanluxppCatalog::~RanluxppCatalog() {
+  if (fHeader != nullptr) {
+    munmap(const_cast<RanluxppCatalogHeader *>(fHeader), fSize);
+  }
+}
+
+bool RanluxppCatalog::Build(const char *path, uint64_t seed, uint64_t spacing,
+                            uint64_t first, uint64_t count) {
+  // Make sure that the distance of the last substream fits into Skip.
+  if (count > 0 && spacing != 0) {
+    uint64_t last = first + (count - 1);
+    if (last < first || last > UINT64_MAX / spacing) {
+      return false;
+    }
+  }
+
+  FILE *file = std::fopen(path, "wb");
+  if (file == nullptr) {
+    return false;
+  }
+
+  RanluxppCatalogHeader header;
+  std::memcpy(header.magic, kMagic, sizeof(kMagic));
+  header.version = kVersion;
+  header.recordSize = sizeof(RanluxppCatalogRecord);
+  header.seed = seed;
+  header.spacing = spacing;
+  header.first = first;
+  header.count = count;
+  header.checksum = 0;
+
+  bool ok = std::fwrite(&header, sizeof(header), 1, file) == 1;
+  uint64_t checksum = hashHeader(header);
+
+  RanluxppEngine engine(seed);
+  engine.Skip(first * spacing);
+  for (uint64_t i = 0; ok && i < count; i++) {
+    if (i > 0) {
+      engine.Skip(spacing);
+    }
+
+    RanluxppCatalogRecord record;
+    for (int j = 0; j < 9; j++) {
+      record.lcg[j] = engine.fLCG[j];
+    }
+    record.position = engine.fPosition;
+
+    ok = ok && std::fwrite(&record, sizeof(record), 1, file) == 1;
+    checksum = fnv1a(checksum, &record, sizeof(record));
+  }
+
+  header.checksum = checksum;
+  ok = ok && std::fseek(file, 0, SEEK_SET) == 0;
+  ok = ok && std::fwrite(&header, sizeof(header), 1, file) == 1;
+  ok = (std::fclose(file) == 0) && ok;
+  if (!ok) {
+    std::remove(path);
+  }
+  return ok;
+}
+
+bool RanluxppCatalog::Verify() const {
+  if (!IsValid()) {
+    return false;
+  }
+  uint64_t checksum = hashHeader(*fHeader);
+  checksum = fnv1a(checksum, fRecords, Count() * sizeof(RanluxppCatalogRecord));
+  return checksum == fHeader->checksum;
+}
+
+bool RanluxppCatalog::Load(uint64_t index, RanluxppEngine &engine) const {
+  if (!IsValid() || !Contains(index)) {
+    return false;
+  }
+
+  const RanluxppCatalogRecord &record = fRecords[index - First()];
+  uint64_t ranlux[9];
+  unsigned carry;
+  to_ranlux(record.lcg, ranlux, carry);
+  int position = static_cast<int>(record.position);
+  engine = RanluxppEngine(record.lcg, ranlux, position);
+  return true;
+}
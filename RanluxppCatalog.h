@@ -0,0 +1,76 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RanluxppCatalog_h
+#define RanluxppCatalog_h
+
+#include "RanluxppEngine.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/// Header of a catalog file, followed by `count` records
+struct RanluxppCatalogHeader {
+  char magic[8];       ///< Always "RLXPPCAT"
+  uint32_t version;    ///< Version of the file format
+  uint32_t recordSize; ///< Size of each record in bytes
+  uint64_t seed;       ///< Seed passed to RanluxppEngine::SetSeed
+  uint64_t spacing;    ///< Distance between substreams in random numbers
+  uint64_t first;      ///< Index of the first substream in the file
+  uint64_t count;      ///< Number of records in the file
+  uint64_t checksum;   ///< FNV-1a hash of header and records
+};
+
+/// Precomputed state of one substream
+struct RanluxppCatalogRecord {
+  uint64_t lcg[9];   ///< LCG state of the generator
+  uint64_t position; ///< Number of random numbers used in the current block
+};
+
+/// Read-only catalog of precomputed substream states, mapped into memory
+///
+/// Substream `i` starts at the state of a RanluxppEngine seeded with `seed`
+/// after skipping `i * spacing` random numbers. The file stores the states for
+/// the substreams `first` to `first + count - 1` in native byte order, so that
+/// an engine only needs to convert the LCG state of a record to RANLUX numbers.
+class RanluxppCatalog final {
+
+private:
+  const RanluxppCatalogHeader *fHeader = nullptr; ///< Start of the mapping
+  const RanluxppCatalogRecord *fRecords = nullptr; ///< First record
+  size_t fSize = 0;                                ///< Size of the mapping
+
+public:
+  /// Map the catalog at `path` into memory, check IsValid() for success
+  RanluxppCatalog(const char *path);
+  ~RanluxppCatalog();
+
+  RanluxppCatalog(const RanluxppCatalog &) = delete;
+  RanluxppCatalog &operator=(const RanluxppCatalog &) = delete;
+
+  /// Write a catalog with `count` substreams starting at index `first`
+  static bool Build(const char *path, uint64_t seed, uint64_t spacing,
+                    uint64_t first, uint64_t count);
+
+  /// Return if the file could be mapped and has a consistent header and records
+  bool IsValid() const { return fHeader != nullptr; }
+  /// Recompute the checksum of the whole file and compare with the header
+  bool Verify() const;
+
+  uint64_t Seed() const { return fHeader->seed; }
+  uint64_t Spacing() const { return fHeader->spacing; }
+  uint64_t First() const { return fHeader->first; }
+  uint64_t Count() const { return fHeader->count; }
+
+  /// Return if the substream with (absolute) `index` is stored in the file
+  bool Contains(uint64_t index) const {
+    return index >= First() && index - First() < Count();
+  }
+
+  /// Position `engine` at the start of substream `index`
+  ///
+  /// Return false and leave `engine` unchanged if the substream is not stored
+  /// in the file.
+  bool Load(uint64_t index, RanluxppEngine &engine) const;
+};
+
+#endif // RanluxppCatalog_h
@@ -1,11 +1,16 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
 #include "RanluxppCompatEngine.h"
+#include "RanluxppCompatEngineImpl.h"
 
+#include "ranluxpp/instrumentation.h"
 #include "ranluxpp/mulmod.h"
+#include "ranluxpp/mulmod_lanes.h"
 #include "ranluxpp/ranlux_lcg.h"
+#include "ranluxpp/unpack.h"
 
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
 
 namespace {
@@ -82,225 +87,199 @@ const uint64_t RanluxppData<794>::kA[] = {
 
 } // end anonymous namespace
 
-template <int w, int p, int u> class RanluxppCompatEngineImpl {
-  // Needs direct access to private members to initialize its four states.
-  friend class RanluxppCompatEngineLuescherImpl<w, p>;
-
-private:
-  uint64_t fState[9]; ///< RANLUX state of the generator
-  unsigned fCarry;    ///< Carry bit of the RANLUX state
-  int fPosition = 0;  ///< Current position in bits
-
-  static constexpr const uint64_t *kA = RanluxppData<p>::kA;
-  static constexpr int kMaxPos = (u == 0) ? 9 * 64 : u * w;
-  static_assert(kMaxPos <= 576, "maximum position larger than 576 bits");
-
-  /// Advance with given multiplier
-  void Advance(const uint64_t *a) {
-    uint64_t lcg[9];
-    to_lcg(fState, fCarry, lcg);
-    mulmod(a, lcg);
-    to_ranlux(lcg, fState, fCarry);
-    fPosition = 0;
-  }
-
-  /// Produce next block of random bits
-  void Advance() { Advance(kA); }
-
-  /// Skip 24 RANLUX numbers
-  void Skip24() { Advance(RanluxppData<24>::kA); }
-
-public:
-  /// Return the next random bits, generate a new block if necessary
-  uint64_t NextRandomBits() {
-    if (fPosition + w > kMaxPos) {
-      Advance();
+template <int w, int p, int u>
+void RanluxppCompatEngineImpl<w, p, u>::Unpack() {
+  uint64_t ranlux[9];
+  unsigned carry;
+  to_ranlux(fLCG, ranlux, carry);
+  unpack<w, kNumbers>(ranlux, fNumbers);
+}
+
+template <int w, int p, int u>
+void RanluxppCompatEngineImpl<w, p, u>::Advance(const uint64_t *a) {
+  mulmod(a, fLCG);
+  Unpack();
+  fPosition = 0;
+}
+
+template <int w, int p, int u>
+void RanluxppCompatEngineImpl<w, p, u>::Advance() {
+  RANLUXPP_INSTR_COUNT(Compat, blocks, 1);
+  RANLUXPP_INSTR_TIME(Compat, advanceLatency);
+  mulmod_const<RanluxppData<p>::kA>(fLCG);
+  Unpack();
+  fPosition = 0;
+}
+
+template <int w, int p, int u>
+void RanluxppCompatEngineImpl<w, p, u>::Skip24() {
+  Advance(RanluxppData<24>::kA);
+}
+
+template <int w, int p, int u>
+void RanluxppCompatEngineImpl<w, p, u>::SetSeedJames(uint64_t s) {
+  // Multiplicative Congruential generator using formula constants of L'Ecuyer
+  // as described in "A review of pseudorandom number generators" (Fred James)
+  // published in Computer Physics Communications 60 (1990) pages 329-344.
+  int64_t seed = s;
+  auto next = [&]() {
+    const int a = 0xd1a4, b = 0x9c4e, c = 0x2fb3, d = 0x7fffffab;
+    int64_t k = seed / a;
+    seed = b * (seed - k * a) - k * c;
+    if (seed < 0)
+      seed += d;
+    return seed & 0xffffff;
+  };
+
+  uint64_t state[9];
+  // Iteration is reversed because the first number from the MCG goes to the
+  // highest position.
+  for (int i = 6; i >= 0; i -= 3) {
+    uint64_t r[8];
+    for (int j = 0; j < 8; j++) {
+      r[j] = next();
     }
 
-    int idx = fPosition / 64;
-    int offset = fPosition % 64;
-    int numBits = 64 - offset;
-
-    uint64_t bits = fState[idx] >> offset;
-    if (numBits < w) {
-      bits |= fState[idx + 1] << numBits;
-    }
-    bits &= ((uint64_t(1) << w) - 1);
-
-    fPosition += w;
-    assert(fPosition <= kMaxPos && "position out of range!");
-
-    return bits;
+    state[i + 0] = r[7] + (r[6] << 24) + (r[5] << 48);
+    state[i + 1] = (r[5] >> 16) + (r[4] << 8) + (r[3] << 32) + (r[2] << 56);
+    state[i + 2] = (r[2] >> 8) + (r[1] << 16) + (r[0] << 40);
   }
+  to_lcg(state, /*c=*/!seed, fLCG);
 
-  /// Return a floating point number, converted from the next random bits.
-  double NextRandomFloat() {
-    static constexpr double div = 1.0 / (uint64_t(1) << w);
-    uint64_t bits = NextRandomBits();
-    return bits * div;
+  Skip24();
+}
+
+template <int w, int p, int u>
+void RanluxppCompatEngineImpl<w, p, u>::SetSeedGsl(uint32_t s, bool ranlxd) {
+  if (s == 0) {
+    // The default seed for gsl_rng_ranlx* is 1.
+    s = 1;
   }
 
-  /// Initialize and seed the state of the generator as in James' implementation
-  void SetSeedJames(uint64_t s) {
-    // Multiplicative Congruential generator using formula constants of L'Ecuyer
-    // as described in "A review of pseudorandom number generators" (Fred James)
-    // published in Computer Physics Communications 60 (1990) pages 329-344.
-    int64_t seed = s;
-    auto next = [&]() {
-      const int a = 0xd1a4, b = 0x9c4e, c = 0x2fb3, d = 0x7fffffab;
-      int64_t k = seed / a;
-      seed = b * (seed - k * a) - k * c;
-      if (seed < 0)
-        seed += d;
-      return seed & 0xffffff;
-    };
-
-    // Iteration is reversed because the first number from the MCG goes to the
-    // highest position.
-    for (int i = 6; i >= 0; i -= 3) {
-      uint64_t r[8];
-      for (int j = 0; j < 8; j++) {
-        r[j] = next();
+  uint32_t bits = s;
+  auto next_bit = [&]() {
+    int b13 = (bits >> 18) & 0x1;
+    int b31 = bits & 0x1;
+    uint32_t bn = b13 ^ b31;
+    bits = (bn << 30) + (bits >> 1);
+    return b31;
+  };
+  auto next = [&]() {
+    uint64_t ix = 0;
+    for (int i = 0; i < 48; i++) {
+      int iy = next_bit();
+      if (ranlxd) {
+        iy = (iy + 1) % 2;
       }
-
-      fState[i + 0] = r[7] + (r[6] << 24) + (r[5] << 48);
-      fState[i + 1] = (r[5] >> 16) + (r[4] << 8) + (r[3] << 32) + (r[2] << 56);
-      fState[i + 2] = (r[2] >> 8) + (r[1] << 16) + (r[0] << 40);
+      ix = 2 * ix + iy;
     }
-    fCarry = !seed;
-
-    Skip24();
-  }
-
-  /// Initialize and seed the state of the generator as in gsl_rng_ranlx*
-  void SetSeedGsl(uint32_t s, bool ranlxd) {
-    if (s == 0) {
-      // The default seed for gsl_rng_ranlx* is 1.
-      s = 1;
+    return ix;
+  };
+
+  uint64_t state[9];
+  for (int i = 0; i < 9; i += 3) {
+    uint64_t r[4];
+    for (int j = 0; j < 4; j++) {
+      r[j] = next();
     }
 
-    uint32_t bits = s;
-    auto next_bit = [&]() {
-      int b13 = (bits >> 18) & 0x1;
-      int b31 = bits & 0x1;
-      uint32_t bn = b13 ^ b31;
-      bits = (bn << 30) + (bits >> 1);
-      return b31;
-    };
-    auto next = [&]() {
-      uint64_t ix = 0;
-      for (int i = 0; i < 48; i++) {
-        int iy = next_bit();
-        if (ranlxd) {
-          iy = (iy + 1) % 2;
-        }
-        ix = 2 * ix + iy;
-      }
-      return ix;
-    };
-
-    for (int i = 0; i < 9; i += 3) {
-      uint64_t r[4];
-      for (int j = 0; j < 4; j++) {
-        r[j] = next();
-      }
+    state[i + 0] = r[0] + (r[1] << 48);
+    state[i + 1] = (r[1] >> 16) + (r[2] << 32);
+    state[i + 2] = (r[2] >> 32) + (r[3] << 16);
+  }
 
-      fState[i + 0] = r[0] + (r[1] << 48);
-      fState[i + 1] = (r[1] >> 16) + (r[2] << 32);
-      fState[i + 2] = (r[2] >> 32) + (r[3] << 16);
+  to_lcg(state, /*c=*/0, fLCG);
+  Advance();
+}
+
+template <int w, int p, int u>
+void RanluxppCompatEngineImpl<w, p, u>::SetSeedStd24(uint64_t s) {
+  // Seed LCG with given parameters.
+  uint64_t seed = s;
+  const uint64_t a = 40014, m = 2147483563;
+  auto next = [&]() {
+    seed = (a * seed) % m;
+    return seed & 0xffffff;
+  };
+
+  uint64_t state[9];
+  for (int i = 0; i < 9; i += 3) {
+    uint64_t r[8];
+    for (int j = 0; j < 8; j++) {
+      r[j] = next();
     }
 
-    fCarry = 0;
-    fPosition = 0;
-    Advance();
+    state[i + 0] = r[0] + (r[1] << 24) + (r[2] << 48);
+    state[i + 1] = (r[2] >> 16) + (r[3] << 8) + (r[4] << 32) + (r[5] << 56);
+    state[i + 2] = (r[5] >> 8) + (r[6] << 16) + (r[7] << 40);
   }
-
-  /// Initialize and seed the state of the generator as described by the C++
-  /// standard
-  void SetSeedStd24(uint64_t s) {
-    // Seed LCG with given parameters.
-    uint64_t seed = s;
-    const uint64_t a = 40014, m = 2147483563;
-    auto next = [&]() {
-      seed = (a * seed) % m;
-      return seed & 0xffffff;
-    };
-
-    for (int i = 0; i < 9; i += 3) {
-      uint64_t r[8];
-      for (int j = 0; j < 8; j++) {
-        r[j] = next();
-      }
-
-      fState[i + 0] = r[0] + (r[1] << 24) + (r[2] << 48);
-      fState[i + 1] = (r[2] >> 16) + (r[3] << 8) + (r[4] << 32) + (r[5] << 56);
-      fState[i + 2] = (r[5] >> 8) + (r[6] << 16) + (r[7] << 40);
+  to_lcg(state, /*c=*/!seed, fLCG);
+
+  Skip24();
+}
+
+template <int w, int p, int u>
+void RanluxppCompatEngineImpl<w, p, u>::SetSeedStd48(uint64_t s) {
+  // Seed LCG with given parameters.
+  uint64_t seed = s;
+  const uint64_t a = 40014, m = 2147483563;
+  auto next = [&]() {
+    seed = (a * seed) % m;
+    uint64_t result = seed;
+    seed = (a * seed) % m;
+    result += seed << 32;
+    return result & 0xffffffffffff;
+  };
+
+  uint64_t state[9];
+  for (int i = 0; i < 9; i += 3) {
+    uint64_t r[4];
+    for (int j = 0; j < 4; j++) {
+      r[j] = next();
     }
-    fCarry = !seed;
 
-    Skip24();
+    state[i + 0] = r[0] + (r[1] << 48);
+    state[i + 1] = (r[1] >> 16) + (r[2] << 32);
+    state[i + 2] = (r[2] >> 32) + (r[3] << 16);
   }
+  to_lcg(state, /*c=*/!seed, fLCG);
 
-  /// Initialize and seed the state of the generator as described by the C++
-  /// standard
-  void SetSeedStd48(uint64_t s) {
-    // Seed LCG with given parameters.
-    uint64_t seed = s;
-    const uint64_t a = 40014, m = 2147483563;
-    auto next = [&]() {
-      seed = (a * seed) % m;
-      uint64_t result = seed;
-      seed = (a * seed) % m;
-      result += seed << 32;
-      return result & 0xffffffffffff;
-    };
-
-    for (int i = 0; i < 9; i += 3) {
-      uint64_t r[4];
-      for (int j = 0; j < 4; j++) {
-        r[j] = next();
-      }
-
-      fState[i + 0] = r[0] + (r[1] << 48);
-      fState[i + 1] = (r[1] >> 16) + (r[2] << 32);
-      fState[i + 2] = (r[2] >> 32) + (r[3] << 16);
-    }
-    fCarry = !seed;
+  Skip24();
+}
 
-    Skip24();
+template <int w, int p, int u>
+void RanluxppCompatEngineImpl<w, p, u>::Skip(uint64_t n) {
+  uint64_t left = kNumbers - fPosition;
+  if (n < left) {
+    // Just skip the next few entries in the currently available numbers.
+    fPosition += n;
+    return;
   }
 
-  /// Skip `n` random numbers without generating them
-  void Skip(uint64_t n) {
-    int left = (kMaxPos - fPosition) / w;
-    assert(left >= 0 && "position was out of range!");
-    if (n < (uint64_t)left) {
-      // Just skip the next few entries in the currently available bits.
-      fPosition += n * w;
-      assert(fPosition <= kMaxPos && "position out of range!");
-      return;
-    }
+  n -= left;
+  // Need to advance and possibly skip over blocks.
+  uint64_t skip = (n / kNumbers);
 
-    n -= left;
-    // Need to advance and possibly skip over blocks.
-    int nPerState = kMaxPos / w;
-    int skip = (n / nPerState);
+  uint64_t a_skip[9];
+  powermod(RanluxppData<p>::kA, a_skip, skip + 1);
 
-    uint64_t a_skip[9];
-    powermod(kA, a_skip, skip + 1);
+  mulmod(a_skip, fLCG);
+  Unpack();
 
-    uint64_t lcg[9];
-    to_lcg(fState, fCarry, lcg);
-    mulmod(a_skip, lcg);
-    to_ranlux(lcg, fState, fCarry);
-
-    // Potentially skip numbers in the freshly generated block.
-    int remaining = n - skip * nPerState;
-    assert(remaining >= 0 && "should not end up at a negative position!");
-    fPosition = remaining * w;
-    assert(fPosition <= kMaxPos && "position out of range!");
-  }
-};
+  // Potentially skip numbers in the freshly generated block.
+  fPosition = n - skip * kNumbers;
+  assert(fPosition <= kNumbers && "position out of range!");
+}
+
+template class RanluxppCompatEngineImpl<24, 218>;
+template class RanluxppCompatEngineImpl<24, 223>;
+template class RanluxppCompatEngineImpl<24, 389>;
+template class RanluxppCompatEngineImpl<24, 404>;
+template class RanluxppCompatEngineImpl<24, 794>;
+template class RanluxppCompatEngineImpl<48, 404>;
+template class RanluxppCompatEngineImpl<48, 794>;
+template class RanluxppCompatEngineImpl<24, 223, 23>;
+template class RanluxppCompatEngineImpl<48, 2 * 389, 11>;
 
 template <int p>
 RanluxppCompatEngineJames<p>::RanluxppCompatEngineJames(uint64_t seed)
@@ -323,11 +302,31 @@ template <int p> uint64_t RanluxppCompatEngineJames<p>::IntRndm() {
   return fImpl->NextRandomBits();
 }
 
+template <int p>
+void RanluxppCompatEngineJames<p>::Fill(uint64_t *out, size_t n) {
+  fImpl->FillRandomBits(out, n);
+}
+
+template <int p>
+void RanluxppCompatEngineJames<p>::Fill(double *out, size_t n) {
+  fImpl->FillRandomFloats(out, n);
+}
+
+template <int p>
+void RanluxppCompatEngineJames<p>::Fill(float *out, size_t n) {
+  fImpl->FillRandomFloats(out, n);
+}
+
 template <int p> void RanluxppCompatEngineJames<p>::SetSeed(uint64_t seed) {
+  RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+  RANLUXPP_INSTR_TIME(Compat, seedLatency);
   fImpl->SetSeedJames(seed);
 }
 
 template <int p> void RanluxppCompatEngineJames<p>::Skip(uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+  RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+  RANLUXPP_INSTR_TIME(Compat, skipLatency);
   fImpl->Skip(n);
 }
 
@@ -355,11 +354,31 @@ template <int p> uint64_t RanluxppCompatEngineGslRanlxs<p>::IntRndm() {
   return fImpl->NextRandomBits();
 }
 
+template <int p>
+void RanluxppCompatEngineGslRanlxs<p>::Fill(uint64_t *out, size_t n) {
+  fImpl->FillRandomBits(out, n);
+}
+
+template <int p>
+void RanluxppCompatEngineGslRanlxs<p>::Fill(double *out, size_t n) {
+  fImpl->FillRandomFloats(out, n);
+}
+
+template <int p>
+void RanluxppCompatEngineGslRanlxs<p>::Fill(float *out, size_t n) {
+  fImpl->FillRandomFloats(out, n);
+}
+
 template <int p> void RanluxppCompatEngineGslRanlxs<p>::SetSeed(uint64_t seed) {
+  RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+  RANLUXPP_INSTR_TIME(Compat, seedLatency);
   fImpl->SetSeedGsl(seed, /*ranlxd=*/false);
 }
 
 template <int p> void RanluxppCompatEngineGslRanlxs<p>::Skip(uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+  RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+  RANLUXPP_INSTR_TIME(Compat, skipLatency);
   fImpl->Skip(n);
 }
 
@@ -388,100 +407,139 @@ template <int p> uint64_t RanluxppCompatEngineGslRanlxd<p>::IntRndm() {
   return fImpl->NextRandomBits();
 }
 
+template <int p>
+void RanluxppCompatEngineGslRanlxd<p>::Fill(uint64_t *out, size_t n) {
+  fImpl->FillRandomBits(out, n);
+}
+
+template <int p>
+void RanluxppCompatEngineGslRanlxd<p>::Fill(double *out, size_t n) {
+  fImpl->FillRandomFloats(out, n);
+}
+
 template <int p> void RanluxppCompatEngineGslRanlxd<p>::SetSeed(uint64_t seed) {
+  RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+  RANLUXPP_INSTR_TIME(Compat, seedLatency);
   fImpl->SetSeedGsl(seed, /*ranlxd=*/true);
 }
 
 template <int p> void RanluxppCompatEngineGslRanlxd<p>::Skip(uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+  RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+  RANLUXPP_INSTR_TIME(Compat, skipLatency);
   fImpl->Skip(n);
 }
 
 template class RanluxppCompatEngineGslRanlxd<404>;
 template class RanluxppCompatEngineGslRanlxd<794>;
 
-template <int w, int p> class RanluxppCompatEngineLuescherImpl {
+template <int w, int p>
+void RanluxppCompatEngineLuescherImpl<w, p>::Advance(const uint64_t *a) {
+  mulmod_lanes<4>(a, fLCG);
 
-private:
-  RanluxppCompatEngineImpl<w, p> fStates[4]; ///< The states of this generator
-  int fNextState = 0;                        ///< The index of the next state
+  for (int j = 0; j < 4; j++) {
+    uint64_t lcg[9], ranlux[9];
+    unsigned carry;
+    for (int i = 0; i < 9; i++) {
+      lcg[i] = fLCG[i * 4 + j];
+    }
+    to_ranlux(lcg, ranlux, carry);
 
-public:
-  /// Return the next random bits, generate a new block if necessary
-  uint64_t NextRandomBits() {
-    uint64_t bits = fStates[fNextState].NextRandomBits();
-    fNextState = (fNextState + 1) % 4;
-    return bits;
+    // The numbers of the four states are returned in turns.
+    uint64_t numbers[kNumbersPerBlock];
+    unpack<w, kNumbersPerBlock>(ranlux, numbers);
+    for (int k = 0; k < kNumbersPerBlock; k++) {
+      fNumbers[k * 4 + j] = numbers[k];
+    }
   }
 
-  /// Return a floating point number, converted from the next random bits.
-  double NextRandomFloat() {
-    double number = fStates[fNextState].NextRandomFloat();
-    fNextState = (fNextState + 1) % 4;
-    return number;
-  }
+  fPosition = 0;
+}
+
+template <int w, int p> void RanluxppCompatEngineLuescherImpl<w, p>::Advance() {
+  RANLUXPP_INSTR_COUNT(Compat, blocks, 4);
+  RANLUXPP_INSTR_TIME(Compat, advanceLatency);
+  Advance(RanluxppData<p>::kA);
+}
+
+template <int w, int p>
+void RanluxppCompatEngineLuescherImpl<w, p>::SetSeed(uint32_t s, bool ranlxd) {
+  uint32_t bits = s;
+  auto next_bit = [&]() {
+    int b13 = (bits >> 18) & 0x1;
+    int b31 = bits & 0x1;
+    uint32_t bn = b13 ^ b31;
+    bits = (bn << 30) + (bits >> 1);
+    return b31;
+  };
+  auto next = [&]() {
+    uint64_t ix = 0;
+    for (int l = 0; l < 24; l++) {
+      ix = 2 * ix + next_bit();
+    }
+    return ix;
+  };
 
-  /// Initialize and seed the state of the generator as in Lüscher's ranlxs
-  void SetSeed(uint32_t s, bool ranlxd) {
-    uint32_t bits = s;
-    auto next_bit = [&]() {
-      int b13 = (bits >> 18) & 0x1;
-      int b31 = bits & 0x1;
-      uint32_t bn = b13 ^ b31;
-      bits = (bn << 30) + (bits >> 1);
-      return b31;
-    };
-    auto next = [&]() {
-      uint64_t ix = 0;
-      for (int l = 0; l < 24; l++) {
-        ix = 2 * ix + next_bit();
-      }
-      return ix;
-    };
-
-    for (int i = 0; i < 4; i++) {
-      auto &state = fStates[i];
-      for (int j = 0; j < 9; j += 3) {
-        uint64_t r[8];
-        for (int m = 0; m < 8; m++) {
-          uint64_t ix = next();
-          // Lüscher's implementation uses k = (j / 3) * 8 + m, so only
-          // the value of m is important for (k % 4).
-          if ((!ranlxd && (m % 4) == i) || (ranlxd && (m % 4) != i)) {
-            ix = 16777215 - ix;
-          }
-          r[m] = ix;
+  for (int i = 0; i < 4; i++) {
+    uint64_t state[9];
+    for (int j = 0; j < 9; j += 3) {
+      uint64_t r[8];
+      for (int m = 0; m < 8; m++) {
+        uint64_t ix = next();
+        // Lüscher's implementation uses k = (j / 3) * 8 + m, so only
+        // the value of m is important for (k % 4).
+        if ((!ranlxd && (m % 4) == i) || (ranlxd && (m % 4) != i)) {
+          ix = 16777215 - ix;
         }
-
-        state.fState[j + 0] = r[0] + (r[1] << 24) + (r[2] << 48);
-        state.fState[j + 1] =
-            (r[2] >> 16) + (r[3] << 8) + (r[4] << 32) + (r[5] << 56);
-        state.fState[j + 2] = (r[5] >> 8) + (r[6] << 16) + (r[7] << 40);
+        r[m] = ix;
       }
 
-      state.fCarry = 0;
-      state.fPosition = 0;
-      state.Advance();
+      state[j + 0] = r[0] + (r[1] << 24) + (r[2] << 48);
+      state[j + 1] = (r[2] >> 16) + (r[3] << 8) + (r[4] << 32) + (r[5] << 56);
+      state[j + 2] = (r[5] >> 8) + (r[6] << 16) + (r[7] << 40);
+    }
+
+    uint64_t lcg[9];
+    to_lcg(state, /*c=*/0, lcg);
+    for (int j = 0; j < 9; j++) {
+      fLCG[j * 4 + i] = lcg[j];
     }
+  }
 
-    fNextState = 0;
+  Advance();
+}
+
+template <int w, int p>
+void RanluxppCompatEngineLuescherImpl<w, p>::Skip(uint64_t n) {
+  uint64_t left = kNumbers - fPosition;
+  if (n < left) {
+    // Just skip the next few entries in the currently available numbers.
+    fPosition += n;
+    return;
   }
 
-  /// Skip `n` random numbers without generating them
-  void Skip(uint64_t n) {
-    uint64_t nPerState = n / 4;
-    int remainder = n % 4;
-    for (int i = 0; i < 4; i++) {
-      int idx = (fNextState + i) % 4;
-      uint64_t nForThisState = nPerState;
-      if (i < remainder) {
-        nForThisState++;
-      }
-      fStates[idx].Skip(nForThisState);
-    }
-    // Switch the next state according to the remainder.
-    fNextState = (fNextState + remainder) % 4;
+  // All four states skip the same number of blocks, so a single multiplier
+  // advances all of them.
+  n -= left;
+  uint64_t skip = n / kNumbers;
+
+  if (skip == 0) {
+    Advance(RanluxppData<p>::kA);
+  } else {
+    uint64_t a_skip[9];
+    powermod(RanluxppData<p>::kA, a_skip, skip + 1);
+    Advance(a_skip);
   }
-};
+
+  // Potentially skip numbers in the freshly generated blocks.
+  fPosition = n - skip * kNumbers;
+}
+
+template class RanluxppCompatEngineLuescherImpl<24, 218>;
+template class RanluxppCompatEngineLuescherImpl<24, 404>;
+template class RanluxppCompatEngineLuescherImpl<24, 794>;
+template class RanluxppCompatEngineLuescherImpl<48, 404>;
+template class RanluxppCompatEngineLuescherImpl<48, 794>;
 
 template <int p>
 RanluxppCompatEngineLuescherRanlxs<p>::RanluxppCompatEngineLuescherRanlxs(
@@ -506,12 +564,32 @@ template <int p> uint64_t RanluxppCompatEngineLuescherRanlxs<p>::IntRndm() {
   return fImpl->NextRandomBits();
 }
 
+template <int p>
+void RanluxppCompatEngineLuescherRanlxs<p>::Fill(uint64_t *out, size_t n) {
+  fImpl->FillRandomBits(out, n);
+}
+
+template <int p>
+void RanluxppCompatEngineLuescherRanlxs<p>::Fill(double *out, size_t n) {
+  fImpl->FillRandomFloats(out, n);
+}
+
+template <int p>
+void RanluxppCompatEngineLuescherRanlxs<p>::Fill(float *out, size_t n) {
+  fImpl->FillRandomFloats(out, n);
+}
+
 template <int p>
 void RanluxppCompatEngineLuescherRanlxs<p>::SetSeed(uint64_t seed) {
+  RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+  RANLUXPP_INSTR_TIME(Compat, seedLatency);
   fImpl->SetSeed(seed, /*ranlxd=*/false);
 }
 
 template <int p> void RanluxppCompatEngineLuescherRanlxs<p>::Skip(uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+  RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+  RANLUXPP_INSTR_TIME(Compat, skipLatency);
   fImpl->Skip(n);
 }
 
@@ -542,12 +620,27 @@ template <int p> uint64_t RanluxppCompatEngineLuescherRanlxd<p>::IntRndm() {
   return fImpl->NextRandomBits();
 }
 
+template <int p>
+void RanluxppCompatEngineLuescherRanlxd<p>::Fill(uint64_t *out, size_t n) {
+  fImpl->FillRandomBits(out, n);
+}
+
+template <int p>
+void RanluxppCompatEngineLuescherRanlxd<p>::Fill(double *out, size_t n) {
+  fImpl->FillRandomFloats(out, n);
+}
+
 template <int p>
 void RanluxppCompatEngineLuescherRanlxd<p>::SetSeed(uint64_t seed) {
+  RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+  RANLUXPP_INSTR_TIME(Compat, seedLatency);
   fImpl->SetSeed(seed, /*ranlxd=*/true);
 }
 
 template <int p> void RanluxppCompatEngineLuescherRanlxd<p>::Skip(uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+  RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+  RANLUXPP_INSTR_TIME(Compat, skipLatency);
   fImpl->Skip(n);
 }
 
@@ -571,11 +664,30 @@ uint64_t RanluxppCompatEngineStdRanlux24::IntRndm() {
   return fImpl->NextRandomBits();
 }
 
+void RanluxppCompatEngineStdRanlux24::Fill(uint64_t *out, size_t n) {
+  fImpl->FillRandomBits(out, n);
+}
+
+void RanluxppCompatEngineStdRanlux24::Fill(double *out, size_t n) {
+  fImpl->FillRandomFloats(out, n);
+}
+
+void RanluxppCompatEngineStdRanlux24::Fill(float *out, size_t n) {
+  fImpl->FillRandomFloats(out, n);
+}
+
 void RanluxppCompatEngineStdRanlux24::SetSeed(uint64_t seed) {
+  RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+  RANLUXPP_INSTR_TIME(Compat, seedLatency);
   fImpl->SetSeedStd24(seed);
 }
 
-void RanluxppCompatEngineStdRanlux24::Skip(uint64_t n) { fImpl->Skip(n); }
+void RanluxppCompatEngineStdRanlux24::Skip(uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+  RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+  RANLUXPP_INSTR_TIME(Compat, skipLatency);
+  fImpl->Skip(n);
+}
 
 RanluxppCompatEngineStdRanlux48::RanluxppCompatEngineStdRanlux48(uint64_t seed)
     : fImpl(new ImplType) {
@@ -594,8 +706,23 @@ uint64_t RanluxppCompatEngineStdRanlux48::IntRndm() {
   return fImpl->NextRandomBits();
 }
 
+void RanluxppCompatEngineStdRanlux48::Fill(uint64_t *out, size_t n) {
+  fImpl->FillRandomBits(out, n);
+}
+
+void RanluxppCompatEngineStdRanlux48::Fill(double *out, size_t n) {
+  fImpl->FillRandomFloats(out, n);
+}
+
 void RanluxppCompatEngineStdRanlux48::SetSeed(uint64_t seed) {
+  RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+  RANLUXPP_INSTR_TIME(Compat, seedLatency);
   fImpl->SetSeedStd48(seed);
 }
 
-void RanluxppCompatEngineStdRanlux48::Skip(uint64_t n) { fImpl->Skip(n); }
+void RanluxppCompatEngineStdRanlux48::Skip(uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+  RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+  RANLUXPP_INSTR_TIME(Compat, skipLatency);
+  fImpl->Skip(n);
+}
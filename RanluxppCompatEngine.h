@@ -3,6 +3,7 @@
 #ifndef RanluxppCompatEngine_h
 #define RanluxppCompatEngine_h
 
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 
@@ -25,6 +26,15 @@ public:
   /// Generate a random integer value with 24 bits
   uint64_t IntRndm();
 
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n);
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n);
+  /// Fill `out` with the next `n` single precision random numbers, which
+  /// hold all 24 bits: the same as Rndm converted to float
+  void Fill(float *out, size_t n);
+
   /// Initialize and seed the state of the generator
   void SetSeed(uint64_t seed);
   /// Skip `n` random numbers without generating them
@@ -59,6 +69,15 @@ public:
   /// Generate a random integer value with 24 bits
   uint64_t IntRndm();
 
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n);
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n);
+  /// Fill `out` with the next `n` single precision random numbers, which
+  /// hold all 24 bits: the same as Rndm converted to float
+  void Fill(float *out, size_t n);
+
   /// Initialize and seed the state of the generator
   void SetSeed(uint64_t seed);
   /// Skip `n` random numbers without generating them
@@ -91,6 +110,12 @@ public:
   /// Generate a random integer value with 48 bits
   uint64_t IntRndm();
 
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n);
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n);
+
   /// Initialize and seed the state of the generator
   void SetSeed(uint64_t seed);
   /// Skip `n` random numbers without generating them
@@ -123,6 +148,15 @@ public:
   /// Generate a random integer value with 24 bits
   uint64_t IntRndm();
 
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n);
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n);
+  /// Fill `out` with the next `n` single precision random numbers, which
+  /// hold all 24 bits: the same as Rndm converted to float
+  void Fill(float *out, size_t n);
+
   /// Initialize and seed the state of the generator
   void SetSeed(uint64_t seed);
   /// Skip `n` random numbers without generating them
@@ -158,6 +192,12 @@ public:
   /// Generate a random integer value with 48 bits
   uint64_t IntRndm();
 
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n);
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n);
+
   /// Initialize and seed the state of the generator
   void SetSeed(uint64_t seed);
   /// Skip `n` random numbers without generating them
@@ -189,6 +229,15 @@ public:
   /// Generate a random integer value with 24 bits
   uint64_t IntRndm();
 
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n);
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n);
+  /// Fill `out` with the next `n` single precision random numbers, which
+  /// hold all 24 bits: the same as Rndm converted to float
+  void Fill(float *out, size_t n);
+
   /// Initialize and seed the state of the generator
   void SetSeed(uint64_t seed);
   /// Skip `n` random numbers without generating them
@@ -213,6 +262,12 @@ public:
   /// Generate a random integer value with 48 bits
   uint64_t IntRndm();
 
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n);
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n);
+
   /// Initialize and seed the state of the generator
   void SetSeed(uint64_t seed);
   /// Skip `n` random numbers without generating them
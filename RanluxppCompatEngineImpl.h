@@ -0,0 +1,203 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RanluxppCompatEngineImpl_h
+#define RanluxppCompatEngineImpl_h
+
+// State of the compatibility engines. The classes are declared here so that
+// RanluxppCompatValueEngine.h can store them inline and draw numbers without
+// calling into the library; seeding, skipping, and advancing the state are
+// defined in RanluxppCompatEngine.cpp for the supported parameters.
+
+#include "RanluxppCompatEngine.h"
+
+#include "ranluxpp/instrumentation.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+template <int w, int p, int u> class RanluxppCompatEngineImpl {
+
+private:
+  static constexpr int kMaxPos = (u == 0) ? 9 * 64 : u * w;
+  static_assert(kMaxPos <= 576, "maximum position larger than 576 bits");
+  static constexpr int kNumbers = kMaxPos / w;
+
+  uint64_t fLCG[9];            ///< LCG state of the generator
+  uint64_t fNumbers[kNumbers]; ///< Numbers of the RANLUX state
+  int fPosition = 0;           ///< Index of the next number in fNumbers
+
+  /// Convert the LCG state to RANLUX numbers and unpack them
+  void Unpack();
+
+  /// Advance with given multiplier
+  void Advance(const uint64_t *a);
+
+  /// Produce next block of random bits
+  void Advance();
+
+  /// Skip 24 RANLUX numbers
+  void Skip24();
+
+  /// Copy the next `n` numbers to `out`, converted with `convert`, in runs
+  /// of the current block
+  template <class T, class Convert>
+  void Fill(T *out, size_t n, Convert convert) {
+    RANLUXPP_INSTR_COUNT(Compat, numbers, n);
+
+    while (n > 0) {
+      if (fPosition == kNumbers) {
+        Advance();
+      }
+
+      size_t count = std::min<size_t>(kNumbers - fPosition, n);
+      const uint64_t *numbers = fNumbers + fPosition;
+      out = std::transform(numbers, numbers + count, out, convert);
+      fPosition += count;
+      n -= count;
+    }
+  }
+
+public:
+  /// Return the next random bits, generate a new block if necessary
+  uint64_t NextRandomBits() {
+    RANLUXPP_INSTR_COUNT(Compat, numbers, 1);
+
+    if (fPosition == kNumbers) {
+      Advance();
+    }
+    return fNumbers[fPosition++];
+  }
+
+  /// Return a floating point number, converted from the next random bits.
+  double NextRandomFloat() {
+    static constexpr double div = 1.0 / (uint64_t(1) << w);
+    uint64_t bits = NextRandomBits();
+    return bits * div;
+  }
+
+  /// Fill `out` with the next `n` random bits, the same as NextRandomBits
+  void FillRandomBits(uint64_t *out, size_t n) {
+    Fill(out, n, [](uint64_t bits) { return bits; });
+  }
+
+  /// Fill `out` with the next `n` floating point numbers of type T, the same
+  /// as NextRandomFloat converted to T if T has at least w digits
+  template <class T> void FillRandomFloats(T *out, size_t n) {
+    static constexpr T div = T(1) / (uint64_t(1) << w);
+    Fill(out, n, [](uint64_t bits) { return bits * div; });
+  }
+
+  /// Initialize and seed the state of the generator as in James' implementation
+  void SetSeedJames(uint64_t s);
+
+  /// Initialize and seed the state of the generator as in gsl_rng_ranlx*
+  void SetSeedGsl(uint32_t s, bool ranlxd);
+
+  /// Initialize and seed the state of the generator as described by the C++
+  /// standard
+  void SetSeedStd24(uint64_t s);
+
+  /// Initialize and seed the state of the generator as described by the C++
+  /// standard
+  void SetSeedStd48(uint64_t s);
+
+  /// Skip `n` random numbers without generating them
+  void Skip(uint64_t n);
+};
+
+extern template class RanluxppCompatEngineImpl<24, 218>;
+extern template class RanluxppCompatEngineImpl<24, 223>;
+extern template class RanluxppCompatEngineImpl<24, 389>;
+extern template class RanluxppCompatEngineImpl<24, 404>;
+extern template class RanluxppCompatEngineImpl<24, 794>;
+extern template class RanluxppCompatEngineImpl<48, 404>;
+extern template class RanluxppCompatEngineImpl<48, 794>;
+extern template class RanluxppCompatEngineImpl<24, 223, 23>;
+extern template class RanluxppCompatEngineImpl<48, 2 * 389, 11>;
+
+/// Lüscher's implementation interleaves the numbers of four generators
+///
+/// The four generators are always at the same block. Their LCG states are
+/// advanced together, and the numbers of the current blocks are unpacked into
+/// a buffer in the order they are returned.
+template <int w, int p> class RanluxppCompatEngineLuescherImpl {
+
+private:
+  static constexpr int kNumbersPerBlock = 576 / w;
+  static constexpr int kNumbers = 4 * kNumbersPerBlock;
+
+  uint64_t fLCG[9 * 4];        ///< LCG states, interleaved as fLCG[i * 4 + j]
+  uint64_t fNumbers[kNumbers]; ///< Numbers of the four current blocks
+  int fPosition = 0;           ///< Index of the next number in fNumbers
+
+  /// Advance all four states with given multiplier and unpack the numbers
+  void Advance(const uint64_t *a);
+
+  /// Produce the next blocks of random numbers
+  void Advance();
+
+  /// Copy the next `n` numbers to `out`, converted with `convert`, in runs
+  /// of the current blocks, which are already in the interleaved order
+  template <class T, class Convert>
+  void Fill(T *out, size_t n, Convert convert) {
+    RANLUXPP_INSTR_COUNT(Compat, numbers, n);
+
+    while (n > 0) {
+      if (fPosition == kNumbers) {
+        Advance();
+      }
+
+      size_t count = std::min<size_t>(kNumbers - fPosition, n);
+      const uint64_t *numbers = fNumbers + fPosition;
+      out = std::transform(numbers, numbers + count, out, convert);
+      fPosition += count;
+      n -= count;
+    }
+  }
+
+public:
+  /// Return the next random bits, generate new blocks if necessary
+  uint64_t NextRandomBits() {
+    RANLUXPP_INSTR_COUNT(Compat, numbers, 1);
+
+    if (fPosition == kNumbers) {
+      Advance();
+    }
+    return fNumbers[fPosition++];
+  }
+
+  /// Return a floating point number, converted from the next random bits.
+  double NextRandomFloat() {
+    static constexpr double div = 1.0 / (uint64_t(1) << w);
+    uint64_t bits = NextRandomBits();
+    return bits * div;
+  }
+
+  /// Fill `out` with the next `n` random bits, the same as NextRandomBits
+  void FillRandomBits(uint64_t *out, size_t n) {
+    Fill(out, n, [](uint64_t bits) { return bits; });
+  }
+
+  /// Fill `out` with the next `n` floating point numbers of type T, the same
+  /// as NextRandomFloat converted to T if T has at least w digits
+  template <class T> void FillRandomFloats(T *out, size_t n) {
+    static constexpr T div = T(1) / (uint64_t(1) << w);
+    Fill(out, n, [](uint64_t bits) { return bits * div; });
+  }
+
+  /// Initialize and seed the state of the generator as in Lüscher's ranlxs
+  void SetSeed(uint32_t s, bool ranlxd);
+
+  /// Skip `n` random numbers without generating them
+  void Skip(uint64_t n);
+};
+
+extern template class RanluxppCompatEngineLuescherImpl<24, 218>;
+extern template class RanluxppCompatEngineLuescherImpl<24, 404>;
+extern template class RanluxppCompatEngineLuescherImpl<24, 794>;
+extern template class RanluxppCompatEngineLuescherImpl<48, 404>;
+extern template class RanluxppCompatEngineLuescherImpl<48, 794>;
+
+#endif // RanluxppCompatEngineImpl_h
@@ -0,0 +1,336 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RanluxppCompatValueEngine_h
+#define RanluxppCompatValueEngine_h
+
+// Value types of the compatibility engines from RanluxppCompatEngine.h: They
+// produce the same sequences, but store their state inline instead of behind a
+// pointer. Drawing numbers is inlined into the caller, engines can be copied
+// and placed in arrays without any heap allocation. The classes are part of
+// the RANLUX++compat library and are only available for the same parameters.
+
+#include "RanluxppCompatEngineImpl.h"
+
+#include "ranluxpp/instrumentation.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/// Value type of RanluxppCompatEngineJames
+template <int p> class RanluxppCompatValueEngineJames {
+
+private:
+  RanluxppCompatEngineImpl<24, p> fImpl;
+
+public:
+  RanluxppCompatValueEngineJames(uint64_t seed = 314159265) { SetSeed(seed); }
+
+  /// Generate a floating point random number with 24 bits of randomness
+  double Rndm() { return fImpl.NextRandomFloat(); }
+  /// Generate a floating point random number with 24 bits of randomness
+  double operator()() { return fImpl.NextRandomFloat(); }
+  /// Generate a random integer value with 24 bits
+  uint64_t IntRndm() { return fImpl.NextRandomBits(); }
+
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n) { fImpl.FillRandomBits(out, n); }
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n) { fImpl.FillRandomFloats(out, n); }
+  /// Fill `out` with the next `n` single precision random numbers, which
+  /// hold all 24 bits: the same as Rndm converted to float
+  void Fill(float *out, size_t n) { fImpl.FillRandomFloats(out, n); }
+
+  /// Initialize and seed the state of the generator
+  void SetSeed(uint64_t seed) {
+    RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+    RANLUXPP_INSTR_TIME(Compat, seedLatency);
+    fImpl.SetSeedJames(seed);
+  }
+  /// Skip `n` random numbers without generating them
+  void Skip(uint64_t n) {
+    RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+    RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+    RANLUXPP_INSTR_TIME(Compat, skipLatency);
+    fImpl.Skip(n);
+  }
+};
+
+using RanluxppCompatValueEngineJamesP3 = RanluxppCompatValueEngineJames<223>;
+using RanluxppCompatValueEngineJamesP4 = RanluxppCompatValueEngineJames<389>;
+
+/// Value type of RanluxppCompatEngineGslRanlxs
+template <int p> class RanluxppCompatValueEngineGslRanlxs {
+
+private:
+  RanluxppCompatEngineImpl<24, p> fImpl;
+
+public:
+  RanluxppCompatValueEngineGslRanlxs(uint64_t seed = 1) { SetSeed(seed); }
+
+  /// Generate a floating point random number with 24 bits of randomness
+  double Rndm() { return fImpl.NextRandomFloat(); }
+  /// Generate a floating point random number with 24 bits of randomness
+  double operator()() { return fImpl.NextRandomFloat(); }
+  /// Generate a random integer value with 24 bits
+  uint64_t IntRndm() { return fImpl.NextRandomBits(); }
+
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n) { fImpl.FillRandomBits(out, n); }
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n) { fImpl.FillRandomFloats(out, n); }
+  /// Fill `out` with the next `n` single precision random numbers, which
+  /// hold all 24 bits: the same as Rndm converted to float
+  void Fill(float *out, size_t n) { fImpl.FillRandomFloats(out, n); }
+
+  /// Initialize and seed the state of the generator
+  void SetSeed(uint64_t seed) {
+    RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+    RANLUXPP_INSTR_TIME(Compat, seedLatency);
+    fImpl.SetSeedGsl(seed, /*ranlxd=*/false);
+  }
+  /// Skip `n` random numbers without generating them
+  void Skip(uint64_t n) {
+    RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+    RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+    RANLUXPP_INSTR_TIME(Compat, skipLatency);
+    fImpl.Skip(n);
+  }
+};
+
+using RanluxppCompatValueEngineGslRanlxs0 =
+    RanluxppCompatValueEngineGslRanlxs<218>;
+using RanluxppCompatValueEngineGslRanlxs1 =
+    RanluxppCompatValueEngineGslRanlxs<404>;
+using RanluxppCompatValueEngineGslRanlxs2 =
+    RanluxppCompatValueEngineGslRanlxs<794>;
+
+/// Value type of RanluxppCompatEngineGslRanlxd
+template <int p> class RanluxppCompatValueEngineGslRanlxd {
+
+private:
+  RanluxppCompatEngineImpl<48, p> fImpl;
+
+public:
+  RanluxppCompatValueEngineGslRanlxd(uint64_t seed = 1) { SetSeed(seed); }
+
+  /// Generate a floating point random number with 48 bits of randomness
+  double Rndm() { return fImpl.NextRandomFloat(); }
+  /// Generate a floating point random number with 48 bits of randomness
+  double operator()() { return fImpl.NextRandomFloat(); }
+  /// Generate a random integer value with 48 bits
+  uint64_t IntRndm() { return fImpl.NextRandomBits(); }
+
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n) { fImpl.FillRandomBits(out, n); }
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n) { fImpl.FillRandomFloats(out, n); }
+
+  /// Initialize and seed the state of the generator
+  void SetSeed(uint64_t seed) {
+    RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+    RANLUXPP_INSTR_TIME(Compat, seedLatency);
+    fImpl.SetSeedGsl(seed, /*ranlxd=*/true);
+  }
+  /// Skip `n` random numbers without generating them
+  void Skip(uint64_t n) {
+    RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+    RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+    RANLUXPP_INSTR_TIME(Compat, skipLatency);
+    fImpl.Skip(n);
+  }
+};
+
+using RanluxppCompatValueEngineGslRanlxd1 =
+    RanluxppCompatValueEngineGslRanlxd<404>;
+using RanluxppCompatValueEngineGslRanlxd2 =
+    RanluxppCompatValueEngineGslRanlxd<794>;
+
+/// Value type of RanluxppCompatEngineLuescherRanlxs
+template <int p> class RanluxppCompatValueEngineLuescherRanlxs {
+
+private:
+  RanluxppCompatEngineLuescherImpl<24, p> fImpl;
+
+public:
+  RanluxppCompatValueEngineLuescherRanlxs(uint64_t seed = 314159265) {
+    SetSeed(seed);
+  }
+
+  /// Generate a floating point random number with 24 bits of randomness
+  double Rndm() { return fImpl.NextRandomFloat(); }
+  /// Generate a floating point random number with 24 bits of randomness
+  double operator()() { return fImpl.NextRandomFloat(); }
+  /// Generate a random integer value with 24 bits
+  uint64_t IntRndm() { return fImpl.NextRandomBits(); }
+
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n) { fImpl.FillRandomBits(out, n); }
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n) { fImpl.FillRandomFloats(out, n); }
+  /// Fill `out` with the next `n` single precision random numbers, which
+  /// hold all 24 bits: the same as Rndm converted to float
+  void Fill(float *out, size_t n) { fImpl.FillRandomFloats(out, n); }
+
+  /// Initialize and seed the state of the generator
+  void SetSeed(uint64_t seed) {
+    RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+    RANLUXPP_INSTR_TIME(Compat, seedLatency);
+    fImpl.SetSeed(seed, /*ranlxd=*/false);
+  }
+  /// Skip `n` random numbers without generating them
+  void Skip(uint64_t n) {
+    RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+    RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+    RANLUXPP_INSTR_TIME(Compat, skipLatency);
+    fImpl.Skip(n);
+  }
+};
+
+using RanluxppCompatValueEngineLuescherRanlxs0 =
+    RanluxppCompatValueEngineLuescherRanlxs<218>;
+using RanluxppCompatValueEngineLuescherRanlxs1 =
+    RanluxppCompatValueEngineLuescherRanlxs<404>;
+using RanluxppCompatValueEngineLuescherRanlxs2 =
+    RanluxppCompatValueEngineLuescherRanlxs<794>;
+
+/// Value type of RanluxppCompatEngineLuescherRanlxd
+template <int p> class RanluxppCompatValueEngineLuescherRanlxd {
+
+private:
+  RanluxppCompatEngineLuescherImpl<48, p> fImpl;
+
+public:
+  RanluxppCompatValueEngineLuescherRanlxd(uint64_t seed = 314159265) {
+    SetSeed(seed);
+  }
+
+  /// Generate a floating point random number with 48 bits of randomness
+  double Rndm() { return fImpl.NextRandomFloat(); }
+  /// Generate a floating point random number with 48 bits of randomness
+  double operator()() { return fImpl.NextRandomFloat(); }
+  /// Generate a random integer value with 48 bits
+  uint64_t IntRndm() { return fImpl.NextRandomBits(); }
+
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n) { fImpl.FillRandomBits(out, n); }
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n) { fImpl.FillRandomFloats(out, n); }
+
+  /// Initialize and seed the state of the generator
+  void SetSeed(uint64_t seed) {
+    RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+    RANLUXPP_INSTR_TIME(Compat, seedLatency);
+    fImpl.SetSeed(seed, /*ranlxd=*/true);
+  }
+  /// Skip `n` random numbers without generating them
+  void Skip(uint64_t n) {
+    RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+    RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+    RANLUXPP_INSTR_TIME(Compat, skipLatency);
+    fImpl.Skip(n);
+  }
+};
+
+using RanluxppCompatValueEngineLuescherRanlxd1 =
+    RanluxppCompatValueEngineLuescherRanlxd<404>;
+using RanluxppCompatValueEngineLuescherRanlxd2 =
+    RanluxppCompatValueEngineLuescherRanlxd<794>;
+
+/// Value type of RanluxppCompatEngineStdRanlux24
+class RanluxppCompatValueEngineStdRanlux24 {
+
+private:
+  RanluxppCompatEngineImpl<24, 223, 23> fImpl;
+
+public:
+  RanluxppCompatValueEngineStdRanlux24(uint64_t seed = 19780503) {
+    SetSeed(seed);
+  }
+
+  /// Generate a floating point random number with 24 bits of randomness
+  double Rndm() { return fImpl.NextRandomFloat(); }
+  /// Generate a floating point random number with 24 bits of randomness
+  double operator()() { return fImpl.NextRandomFloat(); }
+  /// Generate a random integer value with 24 bits
+  uint64_t IntRndm() { return fImpl.NextRandomBits(); }
+
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n) { fImpl.FillRandomBits(out, n); }
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n) { fImpl.FillRandomFloats(out, n); }
+  /// Fill `out` with the next `n` single precision random numbers, which
+  /// hold all 24 bits: the same as Rndm converted to float
+  void Fill(float *out, size_t n) { fImpl.FillRandomFloats(out, n); }
+
+  /// Initialize and seed the state of the generator
+  void SetSeed(uint64_t seed) {
+    RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+    RANLUXPP_INSTR_TIME(Compat, seedLatency);
+    fImpl.SetSeedStd24(seed);
+  }
+  /// Skip `n` random numbers without generating them
+  void Skip(uint64_t n) {
+    RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+    RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+    RANLUXPP_INSTR_TIME(Compat, skipLatency);
+    fImpl.Skip(n);
+  }
+};
+
+/// Value type of RanluxppCompatEngineStdRanlux48
+class RanluxppCompatValueEngineStdRanlux48 {
+
+private:
+  RanluxppCompatEngineImpl<48, 2 * 389, 11> fImpl;
+
+public:
+  RanluxppCompatValueEngineStdRanlux48(uint64_t seed = 19780503) {
+    SetSeed(seed);
+  }
+
+  /// Generate a floating point random number with 48 bits of randomness
+  double Rndm() { return fImpl.NextRandomFloat(); }
+  /// Generate a floating point random number with 48 bits of randomness
+  double operator()() { return fImpl.NextRandomFloat(); }
+  /// Generate a random integer value with 48 bits
+  uint64_t IntRndm() { return fImpl.NextRandomBits(); }
+
+  /// Fill `out` with the next `n` random integer values, the same as IntRndm
+  void Fill(uint64_t *out, size_t n) { fImpl.FillRandomBits(out, n); }
+  /// Fill `out` with the next `n` floating point random numbers, the same as
+  /// Rndm
+  void Fill(double *out, size_t n) { fImpl.FillRandomFloats(out, n); }
+
+  /// Initialize and seed the state of the generator
+  void SetSeed(uint64_t seed) {
+    RANLUXPP_INSTR_COUNT(Compat, seeds, 1);
+    RANLUXPP_INSTR_TIME(Compat, seedLatency);
+    fImpl.SetSeedStd48(seed);
+  }
+  /// Skip `n` random numbers without generating them
+  void Skip(uint64_t n) {
+    RANLUXPP_INSTR_COUNT(Compat, skips, 1);
+    RANLUXPP_INSTR_COUNT(Compat, skipDistance, n);
+    RANLUXPP_INSTR_TIME(Compat, skipLatency);
+    fImpl.Skip(n);
+  }
+};
+
+static_assert(
+    std::is_trivially_copyable<RanluxppCompatValueEngineJamesP3>::value,
+    "value engines must be trivially copyable");
+static_assert(
+    std::is_trivially_copyable<RanluxppCompatValueEngineLuescherRanlxd2>::value,
+    "value engines must be trivially copyable");
+static_assert(
+    std::is_trivially_copyable<RanluxppCompatValueEngineStdRanlux48>::value,
+    "value engines must be trivially copyable");
+
+#endif // RanluxppCompatValueEngine_h
@@ -33,109 +33,132 @@ preprint https://arxiv.org/pdf/2106.02504.pdf
 
 #include "RanluxppEngine.h"
 
+#include "ranluxpp/block.h"
+#include "ranluxpp/constants.h"
+#include "ranluxpp/instrumentation.h"
 #include "ranluxpp/mulmod.h"
-#include "ranluxpp/ranlux_lcg.h"
+#include "ranluxpp/unpack.h"
 
 #include <cassert>
 #include <cstdint>
 
-namespace {
-
-const uint64_t kA_2048[] = {
-    0xed7faa90747aaad9, 0x4cec2c78af55c101, 0xe64dcb31c48228ec,
-    0x6d8a15a13bee7cb0, 0x20b2ca60cb78c509, 0x256c3d3c662ea36c,
-    0xff74e54107684ed2, 0x492edfcc0cc8e753, 0xb48c187cf5b22097,
-};
-
-constexpr int kBits = 48;
-
-} // end anonymous namespace
-
 RanluxppEngine::RanluxppEngine(uint64_t seed) {
-  static_assert(sizeof(fState[0]) * 8 == kStateElementBits,
+  static_assert(sizeof(fLCG[0]) * 8 == kStateElementBits,
                 "each element should be 64 bits");
 
   SetSeed(seed);
 }
 
+RanluxppEngine::RanluxppEngine(const uint64_t *lcg, const uint64_t *ranlux,
+                               int position)
+    : fPosition(position) {
+  for (int i = 0; i < kStateElements; i++) {
+    fLCG[i] = lcg[i];
+  }
+  unpack<kBits, kNumbers>(ranlux, fNumbers);
+  assert(fPosition <= kNumbers && "position out of range!");
+}
+
 void RanluxppEngine::SetSeed(uint64_t s) {
-  uint64_t lcg[kStateElements];
-  lcg[0] = 1;
-  for (int i = 1; i < kStateElements; i++) {
-    lcg[i] = 0;
+  RANLUXPP_INSTR_COUNT(Engine, seeds, 1);
+  RANLUXPP_INSTR_TIME(Engine, seedLatency);
+
+  seed_lcg(s, fLCG);
+  Restart();
+}
+
+void RanluxppEngine::SetSeeds(RanluxppEngine *engines, size_t count,
+                              uint64_t seed) {
+  RANLUXPP_INSTR_COUNT(Engine, seeds, count);
+  RANLUXPP_INSTR_TIME(Engine, seedLatency);
+
+  for (size_t i = 0; i < count; i++, seed++) {
+    RanluxppEngine &engine = engines[i];
+    if (i == 0 || seed == 0) {
+      // The first state, or the seed wrapped around: start from the state 1.
+      seed_lcg(seed, engine.fLCG);
+    } else {
+      // Skip another 2 ** 96 states from the previous engine.
+      const RanluxppEngine &previous = engines[i - 1];
+      for (int j = 0; j < kStateElements; j++) {
+        engine.fLCG[j] = previous.fLCG[j];
+      }
+      mulmod_const<kA_2048_2_96>(engine.fLCG);
+    }
+
+    engine.Restart();
   }
+}
 
-  uint64_t a_seed[kStateElements];
-  // Skip 2 ** 96 states.
-  static constexpr uint64_t TwoTo48 = uint64_t(1) << 48;
-  powermod(kA_2048, a_seed, TwoTo48);
-  powermod(a_seed, a_seed, TwoTo48);
-  // Skip another s states.
-  powermod(a_seed, a_seed, s);
-  mulmod(a_seed, lcg);
+void RanluxppEngine::Unpack() { unpack_lcg<kBits>(fLCG, fNumbers); }
 
-  to_ranlux(lcg, fState, fCarry);
+void RanluxppEngine::Restart() {
+  Unpack();
   fPosition = 0;
+  fBits = 0;
+  fNumBits = 0;
+}
+
+void RanluxppEngine::Multiply(const uint64_t *a) {
+  mulmod(a, fLCG);
+  Unpack();
 }
 
 void RanluxppEngine::Advance() {
-  uint64_t lcg[kStateElements];
-  to_lcg(fState, fCarry, lcg);
-  mulmod(kA_2048, lcg);
-  to_ranlux(lcg, fState, fCarry);
-  fPosition = 0;
+  RANLUXPP_INSTR_COUNT(Engine, blocks, 1);
+  RANLUXPP_INSTR_TIME(Engine, advanceLatency);
+
+  advance_block<kBits>(fLCG, fNumbers, fPosition);
 }
 
 uint64_t RanluxppEngine::NextRandomBits() {
-  if (fPosition + kBits > kMaxPos) {
+  RANLUXPP_INSTR_COUNT(Engine, numbers, 1);
+
+  if (fPosition == kNumbers) {
     Advance();
   }
+  return fNumbers[fPosition++];
+}
 
-  int idx = fPosition / kStateElementBits;
-  int offset = fPosition % kStateElementBits;
-  int numBits = kStateElementBits - offset;
-
-  uint64_t bits = fState[idx] >> offset;
-  if (numBits < kBits) {
-    bits |= fState[idx + 1] << numBits;
-  }
-  bits &= ((uint64_t(1) << kBits) - 1);
+/// Skip `n` random numbers without generating them
+void RanluxppEngine::Skip(uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Engine, skips, 1);
+  RANLUXPP_INSTR_COUNT(Engine, skipDistance, n);
+  RANLUXPP_INSTR_TIME(Engine, skipLatency);
 
-  fPosition += kBits;
-  assert(fPosition <= kMaxPos && "position out of range!");
+  // Left over bits of NextBits are not counted as numbers.
+  fBits = 0;
+  fNumBits = 0;
 
-  return bits;
+  skip_numbers<kBits>(n, fLCG, fNumbers, fPosition);
 }
 
-/// Skip `n` random numbers without generating them
-void RanluxppEngine::Skip(uint64_t n) {
-  int left = (kMaxPos - fPosition) / kBits;
-  assert(left >= 0 && "position was out of range!");
-  if (n < (uint64_t)left) {
-    // Just skip the next few entries in the currently available bits.
-    fPosition += n * kBits;
-    assert(fPosition <= kMaxPos && "position out of range!");
+/// Go back `n` random numbers to return them again
+void RanluxppEngine::Rewind(uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Engine, skips, 1);
+  RANLUXPP_INSTR_COUNT(Engine, skipDistance, n);
+  RANLUXPP_INSTR_TIME(Engine, skipLatency);
+
+  // Left over bits of NextBits are not counted as numbers.
+  fBits = 0;
+  fNumBits = 0;
+
+  if (n <= (uint64_t)fPosition) {
+    // Just go back in the currently available numbers.
+    fPosition -= n;
     return;
   }
 
-  n -= left;
-  // Need to advance and possibly skip over blocks.
-  int nPerState = kMaxPos / kBits;
-  int skip = (n / nPerState);
-
-  uint64_t a_skip[kStateElements];
-  powermod(kA_2048, a_skip, skip + 1);
+  n -= fPosition;
+  // Need to go back to the block containing the number.
+  uint64_t blocks = (n + kNumbers - 1) / kNumbers;
 
-  uint64_t lcg[kStateElements];
-  to_lcg(fState, fCarry, lcg);
-  mulmod(a_skip, lcg);
-  to_ranlux(lcg, fState, fCarry);
+  uint64_t a_back[kStateElements];
+  powermod(kA_2048_inv, a_back, blocks);
+  Multiply(a_back);
 
-  // Potentially skip numbers in the freshly generated block.
-  int remaining = n - skip * nPerState;
-  assert(remaining >= 0 && "should not end up at a negative position!");
-  fPosition = remaining * kBits;
-  assert(fPosition <= kMaxPos && "position out of range!");
+  fPosition = blocks * kNumbers - n;
+  assert(fPosition < kNumbers && "position out of range!");
 }
 
 double RanluxppEngine::Rndm() {
@@ -145,3 +168,33 @@ double RanluxppEngine::Rndm() {
 }
 
 uint64_t RanluxppEngine::IntRndm() { return NextRandomBits(); }
+
+uint64_t RanluxppEngine::NextBits(int k) {
+  assert(k >= 1 && k <= 64 && "number of bits out of range!");
+  uint64_t mask = ~uint64_t(0) >> (64 - k);
+
+  if (k <= fNumBits) {
+    uint64_t bits = fBits & mask;
+    fBits >>= k;
+    fNumBits -= k;
+    return bits;
+  }
+
+  // Use the left over bits and take the missing ones from the next numbers.
+  uint64_t bits = fBits;
+  int count = fNumBits;
+  uint64_t number = NextRandomBits();
+  bits |= number << count;
+  while (count + kBits < k) {
+    count += kBits;
+    number = NextRandomBits();
+    bits |= number << count;
+  }
+
+  int used = k - count;
+  fBits = number >> used;
+  fNumBits = kBits - used;
+  return bits & mask;
+}
+
+bool RanluxppEngine::RandomBool() { return NextBits(1) != 0; }
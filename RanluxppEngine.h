@@ -3,20 +3,50 @@
 #ifndef RanluxppEngine_h
 #define RanluxppEngine_h
 
+#include <cstddef>
 #include <cstdint>
 
+class RanluxppCatalog;
+class RanluxppJump;
+class RanluxppSeedCache;
+class RanluxppSplittableEngine;
+class RanluxppStreamKeys;
+
 class RanluxppEngine final {
+  // Needs direct access to private members to store and load states.
+  friend class RanluxppCatalog;
+  // Needs direct access to private members to apply precomputed multipliers.
+  friend class RanluxppJump;
+  // Needs direct access to private members to store and restore seeded states.
+  friend class RanluxppSeedCache;
+  // Needs direct access to private members to construct engines from states.
+  friend class RanluxppSplittableEngine;
+  // Needs direct access to private members to set derived states.
+  friend class RanluxppStreamKeys;
 
 private:
   static constexpr int kStateElements = 9;
   static constexpr int kStateElementBits = 64;
 
   static constexpr int kMaxPos = kStateElements * kStateElementBits;
+  static constexpr int kBits = 48;
+  static constexpr int kNumbers = kMaxPos / kBits;
+
+  uint64_t fLCG[kStateElements];   ///< LCG state of the generator
+  uint64_t fNumbers[kNumbers];     ///< Numbers of the RANLUX state
+  int fPosition = 0;               ///< Index of the next number in fNumbers
+  uint64_t fBits = 0;              ///< Unused bits for NextBits
+  int fNumBits = 0;                ///< Number of unused bits in fBits
 
-  uint64_t fState[kStateElements]; ///< RANLUX state of the generator
-  unsigned fCarry;                 ///< Carry bit of the RANLUX state
-  int fPosition = 0;               ///< Current position in bits
+  /// Construct from a given LCG state and the equivalent RANLUX state
+  RanluxppEngine(const uint64_t *lcg, const uint64_t *ranlux, int position);
 
+  /// Convert the LCG state to RANLUX numbers and unpack them
+  void Unpack();
+  /// Unpack a freshly seeded LCG state and start with its first number
+  void Restart();
+  /// Multiply the LCG state with `a`, without changing the position
+  void Multiply(const uint64_t *a);
   /// Produce next block of random bits
   void Advance();
   /// Return the next random bits, generate a new block if necessary
@@ -29,11 +59,32 @@ public:
   double Rndm();
   /// Generate a random integer value with 48 bits
   uint64_t IntRndm();
+  /// Generate a random integer value with `k` bits, for 1 <= k <= 64
+  ///
+  /// The bits are taken from the blocks in order, starting with the lowest
+  /// bit of the next number, and bits left over from that number are kept for
+  /// the next call. IntRndm and Rndm always use the next full number without
+  /// touching the left over bits; Skip and SetSeed discard them.
+  uint64_t NextBits(int k);
+  /// Generate a random boolean, using a single bit
+  bool RandomBool();
 
   /// Initialize and seed the state of the generator
   void SetSeed(uint64_t seed);
+  /// Seed `count` engines with consecutive seeds, starting at `seed`
+  ///
+  /// The result is identical to calling engines[i].SetSeed(seed + i), but only
+  /// the first state needs a powermod: the state for the next seed is the
+  /// previous one multiplied with the constant for skipping 2 ** 96 blocks.
+  static void SetSeeds(RanluxppEngine *engines, size_t count, uint64_t seed);
   /// Skip `n` random numbers without generating them
   void Skip(uint64_t n);
+  /// Go back `n` random numbers, the opposite of Skip
+  ///
+  /// The state is multiplied with powers of the inverse multiplier, so going
+  /// back costs the same as skipping forward. As for Skip, left over bits of
+  /// NextBits are discarded.
+  void Rewind(uint64_t n);
 };
 
 #endif // RanluxppEngine_h
@@ -0,0 +1,296 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "RanluxppEngineArray.h"
+
+#include "ranluxpp/constants.h"
+#include "ranluxpp/instrumentation.h"
+#include "ranluxpp/mulmod.h"
+#include "ranluxpp/mulmod_lanes.h"
+#include "ranluxpp/ranlux_lcg.h"
+
+#include <cassert>
+#include <cstdint>
+
+RanluxppEngineArray::RanluxppEngineArray(size_t size, uint64_t seed)
+    : fSize(size) {
+  static_assert(kLanes == 4, "seeding assumes groups of four streams");
+  size_t groups = (size + kLanes - 1) / kLanes;
+  fLCG.resize(groups * kStateElements * kLanes);
+  fRanlux.resize(groups * kStateElements * kLanes);
+  fPosition.resize(groups * kLanes);
+
+  SetSeeds(seed);
+}
+
+void RanluxppEngineArray::Unpack(size_t s) {
+  uint64_t lcg[kStateElements];
+  for (int i = 0; i < kStateElements; i++) {
+    lcg[i] = fLCG[Index(s, i)];
+  }
+  uint64_t ranlux[kStateElements];
+  unsigned carry;
+  to_ranlux(lcg, ranlux, carry);
+  for (int i = 0; i < kStateElements; i++) {
+    fRanlux[Index(s, i)] = ranlux[i];
+  }
+}
+
+void RanluxppEngineArray::MultiplyGroup(size_t g, const uint64_t *a) {
+  mulmod_lanes<kLanes>(a, &fLCG[g * kStateElements * kLanes]);
+  for (int l = 0; l < kLanes; l++) {
+    Unpack(g * kLanes + l);
+  }
+}
+
+void RanluxppEngineArray::SetSeed(size_t s, uint64_t seed) {
+  RANLUXPP_INSTR_COUNT(Engine, seeds, 1);
+  RANLUXPP_INSTR_TIME(Engine, seedLatency);
+  assert(s < fSize && "stream index out of range!");
+
+  // Skip 2 ** 96 * s states from the state 1, the same as
+  // RanluxppEngine::SetSeed.
+  uint64_t lcg[kStateElements];
+  powermod(kA_2048_2_96, lcg, seed);
+  for (int i = 0; i < kStateElements; i++) {
+    fLCG[Index(s, i)] = lcg[i];
+  }
+  Unpack(s);
+  fPosition[s] = 0;
+}
+
+void RanluxppEngineArray::SetSeeds(uint64_t seed) {
+  RANLUXPP_INSTR_COUNT(Engine, seeds, fSize);
+  RANLUXPP_INSTR_TIME(Engine, seedLatency);
+
+  size_t groups = fPosition.size() / kLanes;
+  if (groups == 0) {
+    return;
+  }
+
+  // The first group takes one powermod and one mulmod per further stream,
+  // every following group is the previous one multiplied with the same
+  // constant in all lanes.
+  uint64_t lcg[kStateElements];
+  powermod(kA_2048_2_96, lcg, seed);
+  for (int l = 0; l < kLanes; l++) {
+    if (l > 0) {
+      mulmod_const<kA_2048_2_96>(lcg);
+    }
+    for (int i = 0; i < kStateElements; i++) {
+      fLCG[Index(l, i)] = lcg[i];
+    }
+  }
+  for (size_t g = 1; g < groups; g++) {
+    uint64_t *group = &fLCG[g * kStateElements * kLanes];
+    const uint64_t *previous = group - kStateElements * kLanes;
+    for (int i = 0; i < kStateElements * kLanes; i++) {
+      group[i] = previous[i];
+    }
+    mulmod_lanes<kLanes>(kA_2048_2_98, group);
+  }
+
+  for (size_t s = 0; s < fPosition.size(); s++) {
+    if (seed + s < seed) {
+      // The seed wrapped around, the state must restart from 1. Not through
+      // SetSeed, the seeds are already counted above.
+      powermod(kA_2048_2_96, lcg, seed + s);
+      for (int i = 0; i < kStateElements; i++) {
+        fLCG[Index(s, i)] = lcg[i];
+      }
+    }
+    Unpack(s);
+    fPosition[s] = 0;
+  }
+}
+
+void RanluxppEngineArray::Advance() {
+  RANLUXPP_INSTR_COUNT(Engine, blocks, fSize);
+  RANLUXPP_INSTR_TIME(Engine, advanceLatency);
+
+  size_t groups = fPosition.size() / kLanes;
+  for (size_t g = 0; g < groups; g++) {
+    MultiplyGroup(g, kA_2048);
+  }
+  for (size_t s = 0; s < fPosition.size(); s++) {
+    fPosition[s] = 0;
+  }
+}
+
+void RanluxppEngineArray::AdvanceLanes(const size_t *streams, int lanes) {
+  RANLUXPP_INSTR_COUNT(Engine, blocks, lanes);
+
+  // Gather the streams into the layout of one group.
+  uint64_t group[kStateElements * kLanes] = {0};
+  for (int l = 0; l < lanes; l++) {
+    for (int i = 0; i < kStateElements; i++) {
+      group[i * kLanes + l] = fLCG[Index(streams[l], i)];
+    }
+  }
+  mulmod_lanes<kLanes>(kA_2048, group);
+  for (int l = 0; l < lanes; l++) {
+    for (int i = 0; i < kStateElements; i++) {
+      fLCG[Index(streams[l], i)] = group[i * kLanes + l];
+    }
+    Unpack(streams[l]);
+  }
+}
+
+void RanluxppEngineArray::Advance(const size_t *indices, size_t count) {
+  RANLUXPP_INSTR_TIME(Engine, advanceLatency);
+
+  // Collect the streams in chunks of kLanes. A stream is marked in fPosition
+  // when it is collected, so that a repeated index is skipped no matter in
+  // which chunk it appears.
+  size_t streams[kLanes];
+  int lanes = 0;
+  for (size_t k = 0; k < count; k++) {
+    size_t s = indices[k];
+    assert(s < fSize && "stream index out of range!");
+    if (fPosition[s] == kAdvanced) {
+      continue;
+    }
+    fPosition[s] = kAdvanced;
+    streams[lanes++] = s;
+    if (lanes == kLanes) {
+      AdvanceLanes(streams, lanes);
+      lanes = 0;
+    }
+  }
+  if (lanes > 0) {
+    AdvanceLanes(streams, lanes);
+  }
+
+  for (size_t k = 0; k < count; k++) {
+    fPosition[indices[k]] = 0;
+  }
+}
+
+void RanluxppEngineArray::Skip(uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Engine, skips, fSize);
+  RANLUXPP_INSTR_COUNT(Engine, skipDistance, fSize * n);
+  RANLUXPP_INSTR_TIME(Engine, skipLatency);
+
+  // Depending on its position, a stream crosses `blocks` or one more block,
+  // the same as RanluxppEngine::Skip.
+  uint64_t blocks = n / kNumbers;
+  int residual = static_cast<int>(n % kNumbers);
+  uint64_t a[2][kStateElements];
+  powermod(kA_2048, a[0], blocks);
+  for (int i = 0; i < kStateElements; i++) {
+    a[1][i] = a[0][i];
+  }
+  mulmod(kA_2048, a[1]);
+
+  size_t groups = fPosition.size() / kLanes;
+  for (size_t g = 0; g < groups; g++) {
+    // For each lane: 0 if it only moves in the block, 1 to skip `blocks`
+    // blocks, and 2 to skip one more.
+    int multiplier[kLanes];
+    for (int l = 0; l < kLanes; l++) {
+      size_t s = g * kLanes + l;
+      int position = fPosition[s] + residual;
+      multiplier[l] = 1;
+      if (position >= kNumbers) {
+        position -= kNumbers;
+        multiplier[l] = 2;
+      } else if (blocks == 0) {
+        multiplier[l] = 0;
+      }
+      fPosition[s] = static_cast<uint8_t>(position);
+    }
+
+    bool same = true;
+    for (int l = 1; l < kLanes; l++) {
+      same &= (multiplier[l] == multiplier[0]);
+    }
+    if (same) {
+      if (multiplier[0] > 0) {
+        MultiplyGroup(g, a[multiplier[0] - 1]);
+      }
+      continue;
+    }
+
+    for (int l = 0; l < kLanes; l++) {
+      if (multiplier[l] == 0) {
+        continue;
+      }
+      size_t s = g * kLanes + l;
+      uint64_t lcg[kStateElements];
+      for (int i = 0; i < kStateElements; i++) {
+        lcg[i] = fLCG[Index(s, i)];
+      }
+      mulmod(a[multiplier[l] - 1], lcg);
+      for (int i = 0; i < kStateElements; i++) {
+        fLCG[Index(s, i)] = lcg[i];
+      }
+      Unpack(s);
+    }
+  }
+}
+
+uint64_t RanluxppEngineArray::Extract(size_t s) {
+  int position = fPosition[s]++;
+  assert(position < kNumbers && "block exhausted!");
+
+  int offset = position * kBits;
+  int idx = offset / 64;
+  int shift = offset % 64;
+  uint64_t bits = fRanlux[Index(s, idx)] >> shift;
+  if (shift > 64 - kBits) {
+    bits |= fRanlux[Index(s, idx + 1)] << (64 - shift);
+  }
+  return bits & ((uint64_t(1) << kBits) - 1);
+}
+
+void RanluxppEngineArray::AdvanceExhausted(size_t g) {
+  size_t exhausted[kLanes];
+  size_t count = 0;
+  for (int l = 0; l < kLanes; l++) {
+    size_t s = g * kLanes + l;
+    if (s < fSize && fPosition[s] == kNumbers) {
+      exhausted[count++] = s;
+    }
+  }
+
+  if (count == kLanes) {
+    // The common case of streams drawn in lockstep: no gather needed.
+    RANLUXPP_INSTR_COUNT(Engine, blocks, kLanes);
+    MultiplyGroup(g, kA_2048);
+    for (int l = 0; l < kLanes; l++) {
+      fPosition[g * kLanes + l] = 0;
+    }
+  } else if (count > 0) {
+    Advance(exhausted, count);
+  }
+}
+
+void RanluxppEngineArray::Gather(uint64_t *out) {
+  RANLUXPP_INSTR_COUNT(Engine, numbers, fSize);
+
+  size_t groups = fPosition.size() / kLanes;
+  for (size_t g = 0; g < groups; g++) {
+    AdvanceExhausted(g);
+    for (int l = 0; l < kLanes; l++) {
+      size_t s = g * kLanes + l;
+      if (s < fSize) {
+        out[s] = Extract(s);
+      }
+    }
+  }
+}
+
+void RanluxppEngineArray::Gather(double *out) {
+  static constexpr double div = 1.0 / (uint64_t(1) << kBits);
+  RANLUXPP_INSTR_COUNT(Engine, numbers, fSize);
+
+  size_t groups = fPosition.size() / kLanes;
+  for (size_t g = 0; g < groups; g++) {
+    AdvanceExhausted(g);
+    for (int l = 0; l < kLanes; l++) {
+      size_t s = g * kLanes + l;
+      if (s < fSize) {
+        out[s] = Extract(s) * div;
+      }
+    }
+  }
+}
@@ -0,0 +1,78 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RanluxppEngineArray_h
+#define RanluxppEngineArray_h
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/// Many RANLUX++ streams in structure-of-arrays form, with batch operations
+///
+/// Stream s produces the same numbers as a RanluxppEngine seeded with the same
+/// seed and drawn with IntRndm and Rndm. The states are stored in groups of
+/// kLanes streams with their limbs interleaved, the layout of mulmod_lanes, so
+/// that the groups are advanced by the multi-lane kernels. For each stream,
+/// the array keeps the LCG state, the RANLUX numbers of the current block
+/// (packed into 9 words) and the position in the block, 145 bytes in total.
+/// Numbers are extracted on demand.
+class RanluxppEngineArray final {
+
+private:
+  static constexpr int kLanes = 4;
+  static constexpr int kStateElements = 9;
+  static constexpr int kBits = 48;
+  static constexpr int kNumbers = kStateElements * 64 / kBits;
+  /// Position marking a stream that Advance(indices, count) already advanced
+  static constexpr uint8_t kAdvanced = 0xff;
+
+  size_t fSize;                  ///< Number of streams
+  std::vector<uint64_t> fLCG;    ///< LCG states, grouped and interleaved
+  std::vector<uint64_t> fRanlux; ///< RANLUX numbers, grouped and interleaved
+  std::vector<uint8_t> fPosition; ///< Index of the next number per stream
+
+  /// Index of limb `i` of stream `s` in fLCG and fRanlux
+  static size_t Index(size_t s, int i) {
+    return ((s / kLanes) * kStateElements + i) * kLanes + s % kLanes;
+  }
+
+  /// Compute the RANLUX numbers of stream `s` from its LCG state
+  void Unpack(size_t s);
+  /// Multiply the streams of group `g` with `a`, and unpack them
+  void MultiplyGroup(size_t g, const uint64_t *a);
+  /// Advance up to kLanes arbitrary `streams` with the multi-lane kernel
+  void AdvanceLanes(const size_t *streams, int lanes);
+  /// Advance the streams of group `g` that have no numbers left
+  void AdvanceExhausted(size_t g);
+  /// Return the next number of stream `s`, its block must not be exhausted
+  uint64_t Extract(size_t s);
+
+public:
+  /// Create `size` streams with consecutive seeds, stream s with `seed + s`
+  RanluxppEngineArray(size_t size, uint64_t seed = 0);
+
+  /// Number of streams
+  size_t Size() const { return fSize; }
+
+  /// Seed stream `s` with `seed`, the same as RanluxppEngine::SetSeed
+  void SetSeed(size_t s, uint64_t seed);
+  /// Seed all streams with consecutive seeds, stream s with `seed + s`
+  void SetSeeds(uint64_t seed);
+
+  /// Advance all streams to their next block and discard the current one
+  void Advance();
+  /// Advance the streams in `indices` to their next block
+  ///
+  /// Each listed stream advances by exactly one block, also if its index is
+  /// repeated.
+  void Advance(const size_t *indices, size_t count);
+  /// Skip `n` random numbers in all streams without generating them
+  void Skip(uint64_t n);
+
+  /// Gather the next random integer with 48 bits of each stream into `out`
+  void Gather(uint64_t *out);
+  /// Gather the next double-precision random number of each stream into `out`
+  void Gather(double *out);
+};
+
+#endif // RanluxppEngineArray_h
@@ -1,85 +1,60 @@
 // SPDX-License-Identifier: LGPL-2.1-or-later
 
-#include "ranluxpp/mulmod.h"
-#include "ranluxpp/ranlux_lcg.h"
+#include "RanluxppGSL.h"
+
+#include "ranluxpp/block.h"
+#include "ranluxpp/instrumentation.h"
 
 #include <gsl/gsl_rng.h>
 
 #include <assert.h>
 #include <stdint.h>
 
-static const uint64_t kA_2048[] = {
-    0xed7faa90747aaad9, 0x4cec2c78af55c101, 0xe64dcb31c48228ec,
-    0x6d8a15a13bee7cb0, 0x20b2ca60cb78c509, 0x256c3d3c662ea36c,
-    0xff74e54107684ed2, 0x492edfcc0cc8e753, 0xb48c187cf5b22097,
-};
-
 static constexpr int kMaxPos = 9 * 64;
 static constexpr int kBits = 48;
+static constexpr int kNumbers = kMaxPos / kBits;
 
 typedef struct {
-  uint64_t state[9]; ///< RANLUX state of the generator
-  unsigned carry;    ///< Carry bit of the RANLUX state
-  int position;      ///< Current position in bits
+  uint64_t lcg[9];            ///< LCG state of the generator
+  int position;               ///< Index of the next number in numbers
+  uint64_t numbers[kNumbers]; ///< Numbers extracted from the current state
 } ranluxpp_state;
 
 static void ranluxpp_set(void *vstate, unsigned long int s) {
-  ranluxpp_state *state = (ranluxpp_state *)vstate;
-  uint64_t lcg[9];
-  lcg[0] = 1;
-  for (int i = 1; i < 9; i++) {
-    lcg[i] = 0;
-  }
-
-  uint64_t a_seed[9];
-  // Skip 2 ** 96 states.
-  powermod(kA_2048, a_seed, uint64_t(1) << 48);
-  powermod(a_seed, a_seed, uint64_t(1) << 48);
-  // Skip another s states.
-  powermod(a_seed, a_seed, s);
-  mulmod(a_seed, lcg);
+  RANLUXPP_INSTR_COUNT(Gsl, seeds, 1);
+  RANLUXPP_INSTR_TIME(Gsl, seedLatency);
 
-  to_ranlux(lcg, state->state, state->carry);
+  ranluxpp_state *state = (ranluxpp_state *)vstate;
+  // The same state as RanluxppEngine::SetSeed.
+  seed_lcg(s, state->lcg);
+  unpack_lcg<kBits>(state->lcg, state->numbers);
   state->position = 0;
 }
 
 static void ranluxpp_advance(ranluxpp_state *state) {
-  uint64_t lcg[9];
-  to_lcg(state->state, state->carry, lcg);
-  mulmod(kA_2048, lcg);
-  to_ranlux(lcg, state->state, state->carry);
-  state->position = 0;
+  RANLUXPP_INSTR_COUNT(Gsl, blocks, 1);
+  RANLUXPP_INSTR_TIME(Gsl, advanceLatency);
+  advance_block<kBits>(state->lcg, state->numbers, state->position);
 }
 
 static uint64_t ranluxpp_next(ranluxpp_state *state) {
-  if (state->position + kBits > kMaxPos) {
-    ranluxpp_advance(state);
-  }
-
-  int idx = state->position / 64;
-  int offset = state->position % 64;
-  int numBits = 64 - offset;
+  RANLUXPP_INSTR_COUNT(Gsl, numbers, 1);
 
-  uint64_t bits = state->state[idx] >> offset;
-  if (numBits < kBits) {
-    bits |= state->state[idx + 1] << numBits;
+  if (state->position == kNumbers) {
+    ranluxpp_advance(state);
   }
-  bits &= ((uint64_t(1) << kBits) - 1);
-
-  state->position += kBits;
-  assert(state->position <= kMaxPos && "position out of range!");
-
-  return bits;
+  return state->numbers[state->position++];
 }
 
 static unsigned long int ranluxpp_get(void *vstate) {
   return ranluxpp_next((ranluxpp_state *)vstate);
 }
 
+static constexpr double kDiv = 1.0 / (uint64_t(1) << kBits);
+
 static double ranluxpp_get_double(void *vstate) {
-  static constexpr double div = 1.0 / (uint64_t(1) << kBits);
   uint64_t bits = ranluxpp_next((ranluxpp_state *)vstate);
-  return bits * div;
+  return bits * kDiv;
 }
 
 static const gsl_rng_type ranluxpp_type = {
@@ -92,5 +67,37 @@ static const gsl_rng_type ranluxpp_type = {
     &ranluxpp_get_double,
 };
 
-// The only symbol exported from this translation unit.
 const gsl_rng_type *gsl_rng_ranluxpp = &ranluxpp_type;
+
+void gsl_rng_ranluxpp_skip(gsl_rng *r, uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Gsl, skips, 1);
+  RANLUXPP_INSTR_COUNT(Gsl, skipDistance, n);
+  RANLUXPP_INSTR_TIME(Gsl, skipLatency);
+
+  assert(r->type == gsl_rng_ranluxpp && "generator is not gsl_rng_ranluxpp");
+  ranluxpp_state *state = (ranluxpp_state *)r->state;
+  skip_numbers<kBits>(n, state->lcg, state->numbers, state->position);
+}
+
+void gsl_rng_ranluxpp_fill(gsl_rng *r, double *out, size_t n) {
+  RANLUXPP_INSTR_COUNT(Gsl, numbers, n);
+
+  assert(r->type == gsl_rng_ranluxpp && "generator is not gsl_rng_ranluxpp");
+  ranluxpp_state *state = (ranluxpp_state *)r->state;
+
+  while (n > 0) {
+    if (state->position == kNumbers) {
+      ranluxpp_advance(state);
+    }
+
+    size_t left = kNumbers - state->position;
+    size_t count = (n < left) ? n : left;
+    const uint64_t *numbers = state->numbers + state->position;
+    for (size_t i = 0; i < count; i++) {
+      out[i] = numbers[i] * kDiv;
+    }
+    state->position += count;
+    out += count;
+    n -= count;
+  }
+}
@@ -0,0 +1,31 @@
+/* SPDX-License-Identifier: LGPL-2.1-or-later */
+
+#ifndef RanluxppGSL_h
+#define RanluxppGSL_h
+
+#include <gsl/gsl_rng.h>
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Generator type for gsl_rng_alloc */
+extern const gsl_rng_type *gsl_rng_ranluxpp;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The following extensions require a generator of type gsl_rng_ranluxpp. */
+
+/* Skip n random numbers without generating them, for example to partition the
+   sequence for parallel streams. */
+void gsl_rng_ranluxpp_skip(gsl_rng *r, uint64_t n);
+
+/* Fill out with the next n numbers of gsl_rng_uniform, in the same order. */
+void gsl_rng_ranluxpp_fill(gsl_rng *r, double *out, size_t n);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RanluxppGSL_h */
@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Aggregation of the per-thread instrumentation counters, see
+// RanluxppInstrumentation.h and ranluxpp/instrumentation.h.
+
+#include "RanluxppInstrumentation.h"
+
+#include "ranluxpp/instrumentation.h"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+struct Registry {
+  std::mutex mutex;
+  std::vector<RanluxppThreadInstrumentation *> threads;
+  /// Counters of threads that have exited
+  RanluxppCounters retired[kRanluxppInstrumentedEngines] = {};
+};
+
+Registry &GetRegistry() {
+  // Intentionally leaked so that threads exiting during static destruction
+  // can still access it.
+  static Registry *registry = new Registry;
+  return *registry;
+}
+
+void Accumulate(const RanluxppAtomicHistogram &from,
+                RanluxppLatencyHistogram &to) {
+  for (int i = 0; i < RanluxppLatencyHistogram::kBuckets; i++) {
+    to.counts[i] += from.counts[i].load(std::memory_order_relaxed);
+  }
+}
+
+void Accumulate(const RanluxppAtomicCounters &from, RanluxppCounters &to) {
+  to.blocks += from.blocks.load(std::memory_order_relaxed);
+  to.numbers += from.numbers.load(std::memory_order_relaxed);
+  to.skips += from.skips.load(std::memory_order_relaxed);
+  to.skipDistance += from.skipDistance.load(std::memory_order_relaxed);
+  to.seeds += from.seeds.load(std::memory_order_relaxed);
+  Accumulate(from.advanceLatency, to.advanceLatency);
+  Accumulate(from.skipLatency, to.skipLatency);
+  Accumulate(from.seedLatency, to.seedLatency);
+}
+
+void Reset(RanluxppAtomicHistogram &histogram) {
+  for (int i = 0; i < RanluxppLatencyHistogram::kBuckets; i++) {
+    histogram.counts[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+void Reset(RanluxppAtomicCounters &counters) {
+  counters.blocks.store(0, std::memory_order_relaxed);
+  counters.numbers.store(0, std::memory_order_relaxed);
+  counters.skips.store(0, std::memory_order_relaxed);
+  counters.skipDistance.store(0, std::memory_order_relaxed);
+  counters.seeds.store(0, std::memory_order_relaxed);
+  Reset(counters.advanceLatency);
+  Reset(counters.skipLatency);
+  Reset(counters.seedLatency);
+}
+
+} // end anonymous namespace
+
+thread_local RanluxppThreadInstrumentation gRanluxppInstrumentation;
+
+RanluxppThreadInstrumentation::RanluxppThreadInstrumentation() {
+  Registry &registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  registry.threads.push_back(this);
+}
+
+RanluxppThreadInstrumentation::~RanluxppThreadInstrumentation() {
+  Registry &registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (int e = 0; e < kRanluxppInstrumentedEngines; e++) {
+    Accumulate(engines[e], registry.retired[e]);
+  }
+  for (size_t i = 0; i < registry.threads.size(); i++) {
+    if (registry.threads[i] == this) {
+      registry.threads[i] = registry.threads.back();
+      registry.threads.pop_back();
+      break;
+    }
+  }
+}
+
+RanluxppCounters RanluxppGetThreadCounters(RanluxppInstrumentedEngine engine) {
+  RanluxppCounters counters = {};
+  Accumulate(gRanluxppInstrumentation[engine], counters);
+  return counters;
+}
+
+RanluxppCounters RanluxppGetCounters(RanluxppInstrumentedEngine engine) {
+  Registry &registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  int e = static_cast<int>(engine);
+  RanluxppCounters counters = registry.retired[e];
+  for (RanluxppThreadInstrumentation *thread : registry.threads) {
+    Accumulate(thread->engines[e], counters);
+  }
+  return counters;
+}
+
+void RanluxppResetCounters() {
+  Registry &registry = GetRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (int e = 0; e < kRanluxppInstrumentedEngines; e++) {
+    registry.retired[e] = RanluxppCounters();
+  }
+  for (RanluxppThreadInstrumentation *thread : registry.threads) {
+    for (int e = 0; e < kRanluxppInstrumentedEngines; e++) {
+      Reset(thread->engines[e]);
+    }
+  }
+}
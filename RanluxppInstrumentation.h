@@ -0,0 +1,52 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RanluxppInstrumentation_h
+#define RanluxppInstrumentation_h
+
+// The counters are only updated if the libraries were configured with
+// -DRANLUXPP_INSTRUMENTATION=ON, and latencies are only measured with
+// -DRANLUXPP_INSTRUMENTATION_TIMING=ON. Otherwise, the instrumentation has no
+// cost and this interface is not available.
+
+#include <cstdint>
+
+/// Engines with separate counters
+enum class RanluxppInstrumentedEngine {
+  Engine, ///< RanluxppEngine and RanluxppWordEngine
+  Std,    ///< ranluxpp and ranluxpp_word_engine from std_ranluxpp.h
+  Compat, ///< All compatibility engines from RanluxppCompatEngine.h
+  Gsl,    ///< gsl_rng_ranluxpp
+};
+
+static constexpr int kRanluxppInstrumentedEngines = 4;
+
+/// Histogram of latencies with logarithmic buckets
+///
+/// Bucket `i` counts the calls that took between 2^i and 2^(i+1) - 1 ticks,
+/// where a tick is one cycle of the time stamp counter on x86 and one
+/// nanosecond on other architectures.
+struct RanluxppLatencyHistogram {
+  static constexpr int kBuckets = 32;
+  uint64_t counts[kBuckets];
+};
+
+struct RanluxppCounters {
+  uint64_t blocks;       ///< Blocks produced by advancing the state
+  uint64_t numbers;      ///< Random numbers drawn
+  uint64_t skips;        ///< Calls to Skip (or discard)
+  uint64_t skipDistance; ///< Total number of skipped random numbers
+  uint64_t seeds;        ///< Calls to SetSeed (or seed), including constructors
+
+  RanluxppLatencyHistogram advanceLatency; ///< Latencies of advancing the state
+  RanluxppLatencyHistogram skipLatency;    ///< Latencies of Skip
+  RanluxppLatencyHistogram seedLatency;    ///< Latencies of SetSeed
+};
+
+/// Return the counters of the calling thread
+RanluxppCounters RanluxppGetThreadCounters(RanluxppInstrumentedEngine engine);
+/// Return the sum of the counters of all threads, including exited ones
+RanluxppCounters RanluxppGetCounters(RanluxppInstrumentedEngine engine);
+/// Reset the counters of all threads; concurrent updates may be lost
+void RanluxppResetCounters();
+
+#endif // RanluxppInstrumentation_h
@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "RanluxppJump.h"
+
+#include "ranluxpp/constants.h"
+#include "ranluxpp/instrumentation.h"
+#include "ranluxpp/mulmod.h"
+
+#include <cassert>
+#include <cstdint>
+
+void RanluxppJump::Set(uint64_t n) {
+  static_assert(kNumbers == RanluxppEngine::kNumbers,
+                "jump must use the same block size as the engine");
+
+  fBlocks = n / kNumbers;
+  fResidual = n % kNumbers;
+
+  // Depending on the position of the engine, the jump crosses one more block.
+  powermod(kA_2048, fA, fBlocks);
+  for (int i = 0; i < kStateElements; i++) {
+    fANext[i] = fA[i];
+  }
+  mulmod(kA_2048, fANext);
+}
+
+void RanluxppJump::Apply(RanluxppEngine &engine) const {
+  RANLUXPP_INSTR_COUNT(Engine, skips, 1);
+  RANLUXPP_INSTR_COUNT(Engine, skipDistance, fBlocks * kNumbers + fResidual);
+  RANLUXPP_INSTR_TIME(Engine, skipLatency);
+
+  // Left over bits of NextBits are not counted as numbers.
+  engine.fBits = 0;
+  engine.fNumBits = 0;
+
+  int position = engine.fPosition + fResidual;
+  const uint64_t *a = fA;
+  if (position >= kNumbers) {
+    position -= kNumbers;
+    a = fANext;
+  } else if (fBlocks == 0) {
+    // Just skip the next few entries in the currently available numbers.
+    engine.fPosition = position;
+    return;
+  }
+
+  engine.Multiply(a);
+  engine.fPosition = position;
+  assert(engine.fPosition < kNumbers && "position out of range!");
+}
+
+void RanluxppJump::Apply(RanluxppEngine *engines, size_t count) const {
+  for (size_t i = 0; i < count; i++) {
+    Apply(engines[i]);
+  }
+}
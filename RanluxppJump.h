@@ -0,0 +1,42 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RanluxppJump_h
+#define RanluxppJump_h
+
+#include "RanluxppEngine.h"
+
+#include <cstddef>
+#include <cstdint>
+
+/// Precomputed skip over a fixed number of random numbers
+///
+/// RanluxppEngine::Skip computes the power of the multiplier for every call.
+/// A jump stores the multipliers once, so that applying it to an engine costs
+/// at most one mulmod of the LCG state and the conversion of the new state to
+/// RANLUX numbers. The result is identical to calling Skip with the same
+/// distance.
+class RanluxppJump final {
+
+private:
+  static constexpr int kStateElements = 9;
+  static constexpr int kNumbers = 12;
+
+  uint64_t fA[kStateElements];     ///< Multiplier to skip fBlocks blocks
+  uint64_t fANext[kStateElements]; ///< Multiplier to skip fBlocks + 1 blocks
+  uint64_t fBlocks = 0;            ///< Number of complete blocks to skip
+  int fResidual = 0;               ///< Remaining numbers to skip
+
+public:
+  /// Precompute the multipliers to skip `n` random numbers
+  RanluxppJump(uint64_t n = 0) { Set(n); }
+
+  /// Change the distance to `n` random numbers
+  void Set(uint64_t n);
+
+  /// Skip `engine` ahead, the same as engine.Skip(n)
+  void Apply(RanluxppEngine &engine) const;
+  /// Skip `count` engines ahead, the same as calling Skip(n) on each
+  void Apply(RanluxppEngine *engines, size_t count) const;
+};
+
+#endif // RanluxppJump_h
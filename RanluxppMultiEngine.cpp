@@ -0,0 +1,100 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "RanluxppMultiEngine.h"
+
+#include "ranluxpp/block.h"
+#include "ranluxpp/constants.h"
+#include "ranluxpp/instrumentation.h"
+#include "ranluxpp/mulmod_lanes.h"
+
+#include <algorithm>
+#include <cstdint>
+
+template <int N>
+RanluxppMultiEngine<N>::RanluxppMultiEngine(const uint64_t *seeds) {
+  SetSeeds(seeds);
+}
+
+template <int N> void RanluxppMultiEngine<N>::SetSeeds(const uint64_t *seeds) {
+  RANLUXPP_INSTR_COUNT(Engine, seeds, N);
+  RANLUXPP_INSTR_TIME(Engine, seedLatency);
+
+  for (int l = 0; l < N; l++) {
+    // The same state as RanluxppEngine::SetSeed.
+    uint64_t lcg[kStateElements];
+    seed_lcg(seeds[l], lcg);
+    for (int i = 0; i < kStateElements; i++) {
+      fLCG[i * N + l] = lcg[i];
+    }
+  }
+
+  Unpack();
+  fPosition = 0;
+}
+
+template <int N> void RanluxppMultiEngine<N>::Unpack() {
+  for (int l = 0; l < N; l++) {
+    uint64_t lcg[kStateElements];
+    for (int i = 0; i < kStateElements; i++) {
+      lcg[i] = fLCG[i * N + l];
+    }
+    unpack_lcg<kBits>(lcg, fNumbers[l]);
+  }
+}
+
+template <int N> void RanluxppMultiEngine<N>::Advance() {
+  RANLUXPP_INSTR_COUNT(Engine, blocks, N);
+  RANLUXPP_INSTR_TIME(Engine, advanceLatency);
+
+  mulmod_lanes<N>(kA_2048, fLCG);
+  Unpack();
+  fPosition = 0;
+}
+
+template <int N>
+template <class T, class Convert>
+void RanluxppMultiEngine<N>::FillLanes(T *out, size_t n, Convert convert) {
+  RANLUXPP_INSTR_COUNT(Engine, numbers, N * n);
+
+  size_t done = 0;
+  while (done < n) {
+    if (fPosition == kNumbers) {
+      Advance();
+    }
+
+    // Copy as many numbers as possible from the current blocks.
+    size_t count = std::min<size_t>(kNumbers - fPosition, n - done);
+    for (int l = 0; l < N; l++) {
+      const uint64_t *numbers = fNumbers[l] + fPosition;
+      std::transform(numbers, numbers + count, out + l * n + done, convert);
+    }
+    fPosition += count;
+    done += count;
+  }
+}
+
+template <int N> void RanluxppMultiEngine<N>::Fill(uint64_t *out, size_t n) {
+  FillLanes(out, n, [](uint64_t bits) { return bits; });
+}
+
+template <int N> void RanluxppMultiEngine<N>::Fill(double *out, size_t n) {
+  static constexpr double div = 1.0 / (uint64_t(1) << kBits);
+  FillLanes(out, n, [](uint64_t bits) { return bits * div; });
+}
+
+template <int N> void RanluxppMultiEngine<N>::Skip(uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Engine, skips, N);
+  RANLUXPP_INSTR_COUNT(Engine, skipDistance, N * n);
+  RANLUXPP_INSTR_TIME(Engine, skipLatency);
+
+  // All lanes share the position, and thus the multiplier.
+  uint64_t a_skip[kStateElements];
+  if (skip_position<kBits>(n, fPosition, a_skip)) {
+    mulmod_lanes<N>(a_skip, fLCG);
+    Unpack();
+  }
+}
+
+template class RanluxppMultiEngine<2>;
+template class RanluxppMultiEngine<3>;
+template class RanluxppMultiEngine<4>;
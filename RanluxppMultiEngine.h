@@ -0,0 +1,63 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RanluxppMultiEngine_h
+#define RanluxppMultiEngine_h
+
+#include <cstddef>
+#include <cstdint>
+
+/// N independent RANLUX++ engines that are advanced together
+///
+/// Lane l produces the same numbers as a RanluxppEngine seeded with seeds[l].
+/// All lanes draw the same number of values and advance at the same time, so
+/// they share the position in the block and Skip computes one multiplier for
+/// all lanes. The numbers are only returned in bulk with Fill. The LCG states
+/// are stored interleaved and multiplied with mulmod_lanes: with unsigned
+/// __int128, that is one scalar mulmod per lane and costs the same as N
+/// separate engines; only without __int128 and with AVX2 the lanes are
+/// multiplied together with vector instructions.
+template <int N> class RanluxppMultiEngine final {
+  static_assert(N >= 2 && N <= 4, "only 2 to 4 lanes are supported");
+
+private:
+  static constexpr int kStateElements = 9;
+  static constexpr int kBits = 48;
+  static constexpr int kNumbers = kStateElements * 64 / kBits;
+
+  uint64_t fLCG[kStateElements * N]; ///< LCG states, as fLCG[i * N + lane]
+  uint64_t fNumbers[N][kNumbers];    ///< Numbers of the RANLUX states
+  int fPosition = 0;                 ///< Index of the next numbers
+
+  /// Convert the LCG states to RANLUX numbers and unpack them
+  void Unpack();
+  /// Produce next block of random bits for all lanes
+  void Advance();
+  /// Fill `out` lane by lane, converting the numbers with `Convert`
+  template <class T, class Convert>
+  void FillLanes(T *out, size_t n, Convert convert);
+
+public:
+  /// Seed lane l with `seeds[l]`, for N seeds
+  RanluxppMultiEngine(const uint64_t *seeds);
+
+  /// Fill `out` with the next `n` random integers with 48 bits of each lane
+  ///
+  /// The numbers of lane l are stored at out[l * n] to out[l * n + n - 1].
+  void Fill(uint64_t *out, size_t n);
+  /// Fill `out` with the next `n` double-precision numbers of each lane
+  ///
+  /// The layout is the same as for integers, and the numbers are the same as
+  /// returned by RanluxppEngine::Rndm.
+  void Fill(double *out, size_t n);
+
+  /// Initialize and seed lane l with `seeds[l]`, for N seeds
+  void SetSeeds(const uint64_t *seeds);
+  /// Skip `n` random numbers in all lanes without generating them
+  void Skip(uint64_t n);
+};
+
+extern template class RanluxppMultiEngine<2>;
+extern template class RanluxppMultiEngine<3>;
+extern template class RanluxppMultiEngine<4>;
+
+#endif // RanluxppMultiEngine_h
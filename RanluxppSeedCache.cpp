@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "RanluxppSeedCache.h"
+
+#include "ranluxpp/instrumentation.h"
+
+#include <cassert>
+#include <cstdint>
+#include <mutex>
+
+RanluxppSeedCache::RanluxppSeedCache(size_t capacity) : fCapacity(capacity) {
+  assert(capacity > 0 && "cache needs at least one entry!");
+  fIndex.reserve(capacity + 1);
+}
+
+void RanluxppSeedCache::Seed(RanluxppEngine &engine, uint64_t seed) {
+  {
+    std::lock_guard<std::mutex> lock(fMutex);
+    auto it = fIndex.find(seed);
+    if (it != fIndex.end()) {
+      fHits++;
+      fEntries.splice(fEntries.begin(), fEntries, it->second);
+
+      RANLUXPP_INSTR_COUNT(Engine, seeds, 1);
+      const Entry &entry = *it->second;
+      for (int i = 0; i < kStateElements; i++) {
+        engine.fLCG[i] = entry.fLCG[i];
+      }
+      for (int i = 0; i < kNumbers; i++) {
+        engine.fNumbers[i] = entry.fNumbers[i];
+      }
+      engine.fPosition = 0;
+      engine.fBits = 0;
+      engine.fNumBits = 0;
+      return;
+    }
+    fMisses++;
+  }
+
+  // Compute the state without holding the lock.
+  engine.SetSeed(seed);
+
+  std::lock_guard<std::mutex> lock(fMutex);
+  auto it = fIndex.find(seed);
+  if (it != fIndex.end()) {
+    // Another thread inserted the same seed in the meantime.
+    fEntries.splice(fEntries.begin(), fEntries, it->second);
+    return;
+  }
+
+  fEntries.emplace_front();
+  Entry &entry = fEntries.front();
+  entry.fSeed = seed;
+  for (int i = 0; i < kStateElements; i++) {
+    entry.fLCG[i] = engine.fLCG[i];
+  }
+  for (int i = 0; i < kNumbers; i++) {
+    entry.fNumbers[i] = engine.fNumbers[i];
+  }
+  fIndex.emplace(seed, fEntries.begin());
+
+  if (fEntries.size() > fCapacity) {
+    // Evict the least recently used seed.
+    fIndex.erase(fEntries.back().fSeed);
+    fEntries.pop_back();
+  }
+}
+
+size_t RanluxppSeedCache::Size() const {
+  std::lock_guard<std::mutex> lock(fMutex);
+  return fEntries.size();
+}
+
+uint64_t RanluxppSeedCache::Hits() const {
+  std::lock_guard<std::mutex> lock(fMutex);
+  return fHits;
+}
+
+uint64_t RanluxppSeedCache::Misses() const {
+  std::lock_guard<std::mutex> lock(fMutex);
+  return fMisses;
+}
+
+void RanluxppSeedCache::Clear() {
+  std::lock_guard<std::mutex> lock(fMutex);
+  fEntries.clear();
+  fIndex.clear();
+  fHits = 0;
+  fMisses = 0;
+}
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RanluxppSeedCache_h
+#define RanluxppSeedCache_h
+
+#include "RanluxppEngine.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+/// Thread-safe cache of seeded states for engines that are reseeded from a
+/// small working set of seeds
+///
+/// Seed(engine, seed) leaves the engine in the same state as
+/// engine.SetSeed(seed). For the `capacity` most recently used seeds, the cache
+/// keeps the LCG state and the numbers of the first block, so that reseeding
+/// is a copy instead of a powermod and the conversion to RANLUX numbers. On a
+/// miss, the state is computed outside of the lock; threads only serialize on
+/// the lookup and the copy. One cache can be shared by any number of engines.
+class RanluxppSeedCache final {
+
+private:
+  static constexpr int kStateElements = 9;
+  static constexpr int kNumbers = 12;
+
+  struct Entry {
+    uint64_t fSeed;
+    uint64_t fLCG[kStateElements];
+    uint64_t fNumbers[kNumbers];
+  };
+
+  size_t fCapacity;          ///< Maximum number of entries
+  std::list<Entry> fEntries; ///< Entries, the most recently used first
+  std::unordered_map<uint64_t, std::list<Entry>::iterator> fIndex;
+  mutable std::mutex fMutex; ///< Protects all other members
+  uint64_t fHits = 0;        ///< Number of seeds found in the cache
+  uint64_t fMisses = 0;      ///< Number of seeds computed with SetSeed
+
+public:
+  /// Create an empty cache for at most `capacity` seeds, at least one
+  RanluxppSeedCache(size_t capacity);
+
+  /// Seed `engine` with `seed`, the same as engine.SetSeed(seed)
+  void Seed(RanluxppEngine &engine, uint64_t seed);
+
+  /// Maximum number of cached seeds
+  size_t Capacity() const { return fCapacity; }
+  /// Number of cached seeds
+  size_t Size() const;
+  /// Number of calls to Seed that found the seed in the cache
+  uint64_t Hits() const;
+  /// Number of calls to Seed that had to compute the state
+  uint64_t Misses() const;
+
+  /// Remove all entries and reset the counters
+  void Clear();
+};
+
+#endif // RanluxppSeedCache_h
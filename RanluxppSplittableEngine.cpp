@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "RanluxppSplittableEngine.h"
+
+#include "ranluxpp/constants.h"
+#include "ranluxpp/instrumentation.h"
+#include "ranluxpp/mulmod.h"
+#include "ranluxpp/ranlux_lcg.h"
+
+#include <array>
+#include <cassert>
+#include <cstdint>
+
+namespace {
+
+constexpr int kMinPower = 96;
+constexpr int kRootPower = 480;
+
+/// Powers kA_2048 ** (2 ** j) for kMinPower <= j <= kRootPower
+struct PowerTable {
+  uint64_t fA[kRootPower - kMinPower + 1][9];
+
+  PowerTable() {
+    for (int i = 0; i < 9; i++) {
+      fA[0][i] = kA_2048_2_96[i];
+    }
+    for (int j = 1; j <= kRootPower - kMinPower; j++) {
+      for (int i = 0; i < 9; i++) {
+        fA[j][i] = fA[j - 1][i];
+      }
+      mulmod(fA[j - 1], fA[j]);
+    }
+  }
+};
+
+/// Return kA_2048 ** (2 ** j), computing the table on first use
+const uint64_t *Power(int j) {
+  assert(j >= kMinPower && j <= kRootPower && "power out of range!");
+  // Initialization of function-local statics is thread-safe since C++11.
+  static const PowerTable table;
+  return table.fA[j - kMinPower];
+}
+
+/// Return the start of the interval of the root engine for `seed`
+std::array<uint64_t, 9> RootStart(uint64_t seed) {
+  // Start 2 ** 480 * seed blocks after the state 1.
+  std::array<uint64_t, 9> start;
+  powermod(Power(kRootPower), start.data(), seed);
+  return start;
+}
+
+} // end anonymous namespace
+
+RanluxppSplittableEngine::RanluxppSplittableEngine(const uint64_t *start,
+                                                   int depth)
+    : fDepth(depth), fEngine(StartEngine(start)) {
+  for (int i = 0; i < kStateElements; i++) {
+    fStart[i] = start[i];
+  }
+}
+
+RanluxppSplittableEngine::RanluxppSplittableEngine(uint64_t seed)
+    : RanluxppSplittableEngine(RootStart(seed).data(), 0) {
+  static_assert(kRootPower - kMinPower == kMaxDepth, "inconsistent depth");
+}
+
+RanluxppEngine RanluxppSplittableEngine::StartEngine(const uint64_t *lcg) {
+  uint64_t ranlux[kStateElements];
+  unsigned carry;
+  to_ranlux(lcg, ranlux, carry);
+  return RanluxppEngine(lcg, ranlux, 0);
+}
+
+RanluxppSplittableEngine RanluxppSplittableEngine::Split() {
+  RANLUXPP_INSTR_COUNT(Engine, seeds, 1);
+  RANLUXPP_INSTR_TIME(Engine, seedLatency);
+  assert(fDepth < kMaxDepth && "maximum depth reached!");
+
+  // The child starts in the middle of the interval of 2 ** (480 - depth)
+  // blocks.
+  uint64_t start[kStateElements];
+  for (int i = 0; i < kStateElements; i++) {
+    start[i] = fStart[i];
+  }
+  mulmod(Power(kRootPower - 1 - fDepth), start);
+
+  fDepth++;
+  return RanluxppSplittableEngine(start, fDepth);
+}
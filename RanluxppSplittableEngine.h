@@ -0,0 +1,74 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RanluxppSplittableEngine_h
+#define RanluxppSplittableEngine_h
+
+#include "RanluxppEngine.h"
+
+#include <cstdint>
+
+/// Engine that splits off child engines with disjoint streams
+///
+/// Each engine owns an interval of blocks of the LCG sequence that starts from
+/// the state 1, and draws its numbers from the start of that interval. The
+/// root engine for `seed` owns the 2 ** 480 blocks starting at 2 ** 480 * seed.
+/// An engine at depth d owns 2 ** (480 - d) blocks; Split halves the interval:
+/// the parent keeps the lower half and continues its stream unchanged, and the
+/// child gets the upper half, starting 2 ** (479 - d) blocks after the start
+/// of the parent. Both are at depth d + 1 afterwards.
+///
+/// The split tree is thus a binary partition of the intervals: any two engines
+/// derived from the same root, along any path of splits, own disjoint
+/// intervals, and the engines of different roots never meet because all start
+/// blocks are below 2 ** 544, less than the period of more than 2 ** 550
+/// blocks. Splitting is allowed up to kMaxDepth, where each engine still owns
+/// 2 ** 96 blocks, the same as the streams of RanluxppEngine::SetSeed. As long
+/// as no engine draws more numbers than the half it keeps at its next split
+/// (12 * 2 ** 96 at the deepest level), the streams never overlap, and the
+/// stream of an engine only depends on its path from the root.
+///
+/// A split costs one mulmod with a power of kA_2048 from a table, which is
+/// computed once per process on first use, and the conversion of the child
+/// state to RANLUX numbers.
+class RanluxppSplittableEngine final {
+
+private:
+  static constexpr int kStateElements = 9;
+
+  uint64_t fStart[kStateElements]; ///< LCG state at the start of the interval
+  int fDepth;                      ///< Number of splits since the root
+  RanluxppEngine fEngine;          ///< Engine drawing from the interval
+
+  /// Construct the engine for the interval starting at `start`
+  RanluxppSplittableEngine(const uint64_t *start, int depth);
+  /// Return an engine at the first number of the LCG state `lcg`
+  static RanluxppEngine StartEngine(const uint64_t *lcg);
+
+public:
+  /// Maximum depth, where an engine cannot be split anymore
+  static constexpr int kMaxDepth = 384;
+
+  /// Construct the root engine for `seed`
+  RanluxppSplittableEngine(uint64_t seed = 314159265);
+
+  /// Generate a double-precision random number with 48 bits of randomness
+  double Rndm() { return fEngine.Rndm(); }
+  /// Generate a random integer value with 48 bits
+  uint64_t IntRndm() { return fEngine.IntRndm(); }
+
+  /// Access the engine, for example to skip numbers or for NextBits
+  ///
+  /// Seeding the engine (or rewinding it past the start) leaves the interval
+  /// and voids the guarantees of the split tree.
+  RanluxppEngine &Engine() { return fEngine; }
+
+  /// Number of splits since the root engine
+  int Depth() const { return fDepth; }
+
+  /// Split off a child engine with the upper half of the interval
+  ///
+  /// The depth must be less than kMaxDepth.
+  RanluxppSplittableEngine Split();
+};
+
+#endif // RanluxppSplittableEngine_h
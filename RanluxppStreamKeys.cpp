@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "RanluxppStreamKeys.h"
+
+#include "ranluxpp/constants.h"
+#include "ranluxpp/instrumentation.h"
+#include "ranluxpp/mulmod.h"
+
+#include <cstdint>
+
+RanluxppStreamKeys::RanluxppStreamKeys(uint64_t run, uint64_t event) {
+  SetRun(run, event);
+}
+
+void RanluxppStreamKeys::SetRun(uint64_t run, uint64_t event) {
+  powermod(kA_2048_2_224, fRunA, run);
+  powermod(kA_2048_2_160, fEventA, event);
+  mulmod(fRunA, fEventA);
+
+  fRun = run;
+  fEvent = event;
+  fHaveParticle = false;
+}
+
+void RanluxppStreamKeys::SetEvent(uint64_t event) {
+  if (event == fEvent) {
+    return;
+  } else if (event == fEvent + 1 && event != 0) {
+    // The next event starts 2 ** 160 blocks later.
+    mulmod_const<kA_2048_2_160>(fEventA);
+  } else {
+    powermod(kA_2048_2_160, fEventA, event);
+    mulmod(fRunA, fEventA);
+  }
+
+  fEvent = event;
+  fHaveParticle = false;
+}
+
+void RanluxppStreamKeys::Seed(RanluxppEngine &engine, uint64_t particle) {
+  RANLUXPP_INSTR_COUNT(Engine, seeds, 1);
+  RANLUXPP_INSTR_TIME(Engine, seedLatency);
+
+  if (fHaveParticle && particle == fParticle + 1 && particle != 0) {
+    // The next particle starts 2 ** 96 blocks later.
+    mulmod_const<kA_2048_2_96>(fLCG);
+  } else if (!fHaveParticle || particle != fParticle) {
+    powermod(kA_2048_2_96, fLCG, particle);
+    mulmod(fEventA, fLCG);
+  }
+  fParticle = particle;
+  fHaveParticle = true;
+
+  for (int i = 0; i < kStateElements; i++) {
+    engine.fLCG[i] = fLCG[i];
+  }
+  engine.Restart();
+}
+
+void RanluxppStreamKeys::Seed(RanluxppEngine &engine, uint64_t run,
+                              uint64_t event, uint64_t particle) {
+  if (run != fRun) {
+    SetRun(run, event);
+  } else {
+    SetEvent(event);
+  }
+  Seed(engine, particle);
+}
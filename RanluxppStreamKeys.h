@@ -0,0 +1,58 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RanluxppStreamKeys_h
+#define RanluxppStreamKeys_h
+
+#include "RanluxppEngine.h"
+
+#include <cstdint>
+
+/// Seeding of engines from hierarchical keys (run, event, particle)
+///
+/// The stream of a key starts at the block
+///     2 ** 96 * (particle + 2 ** 64 * event + 2 ** 128 * run)
+/// of the LCG sequence that starts from the state 1. The key (0, 0, s) is the
+/// same stream as RanluxppEngine::SetSeed(s).
+///
+/// Disjointness: every stream has 2 ** 96 blocks (12 * 2 ** 96 numbers) before
+/// it reaches the start of the next particle. The particles of an event cover
+/// 2 ** 160 blocks before the next event, and the events of a run 2 ** 224
+/// blocks before the next run. All start blocks are below 2 ** 288 and thus
+/// far from the period of more than 2 ** 550 blocks. As long as no engine
+/// draws more than 12 * 2 ** 96 numbers, the streams of different keys never
+/// overlap, at any level, and the stream of a key does not depend on which
+/// keys were used before.
+///
+/// The multipliers for the current run and event are cached. Moving to the
+/// next particle (or to the next event in the same run) costs one mulmod;
+/// other indices need one powermod with a 64 bit exponent.
+class RanluxppStreamKeys final {
+
+private:
+  static constexpr int kStateElements = 9;
+
+  uint64_t fRunA[kStateElements];   ///< Multiplier for the start of the run
+  uint64_t fEventA[kStateElements]; ///< Multiplier for the start of the event
+  uint64_t fLCG[kStateElements];    ///< LCG state of the last particle
+  uint64_t fRun = 0;                ///< Index of the current run
+  uint64_t fEvent = 0;              ///< Index of the current event
+  uint64_t fParticle = 0;           ///< Index of the last particle
+  bool fHaveParticle = false;       ///< If fLCG belongs to fParticle
+
+public:
+  /// Prepare the multipliers for `run` and `event`
+  RanluxppStreamKeys(uint64_t run = 0, uint64_t event = 0);
+
+  /// Change the run, and start with its first event
+  void SetRun(uint64_t run, uint64_t event = 0);
+  /// Change the event in the current run
+  void SetEvent(uint64_t event);
+
+  /// Seed `engine` with the stream of `particle` in the current run and event
+  void Seed(RanluxppEngine &engine, uint64_t particle);
+  /// Seed `engine` with the stream of the key, changing the run and event
+  void Seed(RanluxppEngine &engine, uint64_t run, uint64_t event,
+            uint64_t particle);
+};
+
+#endif // RanluxppStreamKeys_h
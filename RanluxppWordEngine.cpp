@@ -0,0 +1,67 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include "RanluxppWordEngine.h"
+
+#include "ranluxpp/block.h"
+#include "ranluxpp/instrumentation.h"
+
+#include <algorithm>
+#include <cstdint>
+
+template <int w> RanluxppWordEngine<w>::RanluxppWordEngine(uint64_t seed) {
+  SetSeed(seed);
+}
+
+template <int w> void RanluxppWordEngine<w>::SetSeed(uint64_t s) {
+  RANLUXPP_INSTR_COUNT(Engine, seeds, 1);
+  RANLUXPP_INSTR_TIME(Engine, seedLatency);
+
+  // The same state as RanluxppEngine::SetSeed.
+  seed_lcg(s, fLCG);
+  unpack_lcg<w>(fLCG, fNumbers);
+  fPosition = 0;
+}
+
+template <int w> void RanluxppWordEngine<w>::Advance() {
+  RANLUXPP_INSTR_COUNT(Engine, blocks, 1);
+  RANLUXPP_INSTR_TIME(Engine, advanceLatency);
+
+  advance_block<w>(fLCG, fNumbers, fPosition);
+}
+
+template <int w> uint64_t RanluxppWordEngine<w>::IntRndm() {
+  RANLUXPP_INSTR_COUNT(Engine, numbers, 1);
+
+  if (fPosition == kNumbers) {
+    Advance();
+  }
+  return fNumbers[fPosition++];
+}
+
+template <int w> void RanluxppWordEngine<w>::Fill(uint64_t *out, size_t n) {
+  RANLUXPP_INSTR_COUNT(Engine, numbers, n);
+
+  while (n > 0) {
+    if (fPosition == kNumbers) {
+      Advance();
+    }
+
+    // Copy as many numbers as possible from the current block.
+    size_t count = std::min<size_t>(kNumbers - fPosition, n);
+    const uint64_t *numbers = fNumbers + fPosition;
+    out = std::copy(numbers, numbers + count, out);
+    fPosition += count;
+    n -= count;
+  }
+}
+
+template <int w> void RanluxppWordEngine<w>::Skip(uint64_t n) {
+  RANLUXPP_INSTR_COUNT(Engine, skips, 1);
+  RANLUXPP_INSTR_COUNT(Engine, skipDistance, n);
+  RANLUXPP_INSTR_TIME(Engine, skipLatency);
+
+  skip_numbers<w>(n, fLCG, fNumbers, fPosition);
+}
+
+template class RanluxppWordEngine<32>;
+template class RanluxppWordEngine<64>;
@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RanluxppWordEngine_h
+#define RanluxppWordEngine_h
+
+#include <cstddef>
+#include <cstdint>
+
+/// RANLUX++ generator returning full 32 or 64 bit integers
+///
+/// The engine is seeded like RanluxppEngine and produces the same blocks of
+/// 576 random bits, but slices each block into 18 numbers of 32 bits or 9
+/// numbers of 64 bits instead of 12 numbers of 48 bits. All bits of a block
+/// are used, and Skip counts numbers of w bits.
+template <int w> class RanluxppWordEngine final {
+  static_assert(w == 32 || w == 64, "only 32 and 64 bit words are supported");
+
+private:
+  static constexpr int kStateElements = 9;
+  static constexpr int kNumbers = kStateElements * 64 / w;
+
+  uint64_t fLCG[kStateElements]; ///< LCG state of the generator
+  uint64_t fNumbers[kNumbers];   ///< Numbers of the RANLUX state
+  int fPosition = 0;             ///< Index of the next number in fNumbers
+
+  /// Produce next block of random bits
+  void Advance();
+
+public:
+  RanluxppWordEngine(uint64_t seed = 314159265);
+
+  /// Smallest value returned by IntRndm
+  static constexpr uint64_t Min() { return 0; }
+  /// Largest value returned by IntRndm
+  static constexpr uint64_t Max() { return ~uint64_t(0) >> (64 - w); }
+
+  /// Generate a random integer value with w bits
+  uint64_t IntRndm();
+  /// Fill `out` with the next `n` random integer values, block by block
+  void Fill(uint64_t *out, size_t n);
+
+  /// Initialize and seed the state of the generator
+  void SetSeed(uint64_t seed);
+  /// Skip `n` random numbers without generating them
+  void Skip(uint64_t n);
+};
+
+extern template class RanluxppWordEngine<32>;
+extern template class RanluxppWordEngine<64>;
+
+using RanluxppEngine32 = RanluxppWordEngine<32>;
+using RanluxppEngine64 = RanluxppWordEngine<64>;
+
+#endif // RanluxppWordEngine_h
@@ -0,0 +1,157 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RANLUXPP_BENCH_H
+#define RANLUXPP_BENCH_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+/// Prevent the compiler from optimizing away the computation of `value`
+template <typename T> static inline void DoNotOptimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/// Run `f(n)`, which performs `n` operations, and return the elapsed seconds
+template <typename F> static double Measure(uint64_t n, F &&f) {
+  auto start = std::chrono::steady_clock::now();
+  f(n);
+  auto end = std::chrono::steady_clock::now();
+  return std::chrono::duration<double>(end - start).count();
+}
+
+/// Driver for a set of benchmarks with text, CSV or JSON output
+///
+/// Recognized command line arguments:
+///  - `--format=text|csv|json` selects the output format (default: text)
+///  - `--filter=<substring>` only runs benchmarks whose name contains it
+///  - `--repetitions=<n>` runs each benchmark n times and reports the fastest
+///  - `--output=<file>` writes the results to a file instead of stdout
+class Bench {
+
+private:
+  enum Format { kText, kCSV, kJSON };
+
+  Format fFormat = kText;
+  const char *fFilter = nullptr;
+  int fRepetitions = 5;
+  bool fFirst = true;
+
+public:
+  Bench(int argc, char *argv[]) {
+    for (int i = 1; i < argc; i++) {
+      const char *arg = argv[i];
+      if (std::strcmp(arg, "--format=csv") == 0) {
+        fFormat = kCSV;
+      } else if (std::strcmp(arg, "--format=json") == 0) {
+        fFormat = kJSON;
+      } else if (std::strcmp(arg, "--format=text") == 0) {
+        fFormat = kText;
+      } else if (std::strncmp(arg, "--filter=", 9) == 0) {
+        fFilter = arg + 9;
+      } else if (std::strncmp(arg, "--repetitions=", 14) == 0) {
+        fRepetitions = std::max(1, std::atoi(arg + 14));
+      } else if (std::strncmp(arg, "--output=", 9) == 0) {
+        if (std::freopen(arg + 9, "w", stdout) == nullptr) {
+          std::fprintf(stderr, "could not open '%s'\n", arg + 9);
+          std::exit(1);
+        }
+      } else {
+        std::fprintf(stderr, "unknown argument '%s'\n", arg);
+        std::exit(1);
+      }
+    }
+
+    if (fFormat == kCSV) {
+      std::printf("name,ops,ns_per_op,ops_per_s,cycles_per_op,"
+                  "instructions_per_op,ipc\n");
+    } else if (fFormat == kJSON) {
+      std::printf("[");
+    }
+  }
+
+  ~Bench() {
+    if (fFormat == kJSON) {
+      std::printf("\n]\n");
+    }
+  }
+
+  Bench(const Bench &) = delete;
+  Bench &operator=(const Bench &) = delete;
+
+  /// Return if the benchmark `name` is selected by the filter
+  bool Enabled(const char *name) const {
+    return fFilter == nullptr || std::strstr(name, fFilter) != nullptr;
+  }
+
+  /// Print the time per operation of one benchmark
+  ///
+  /// Optionally, `cycles` and `instructions` for all `n` operations can be
+  /// passed, negative values mean that they were not measured.
+  void Report(const char *name, uint64_t n, double seconds,
+              double cycles = -1, double instructions = -1) {
+    double ns = seconds / n * 1e9;
+    double perSecond = n / seconds;
+    char cyclesStr[32] = "", instructionsStr[32] = "", ipcStr[32] = "";
+    const char *null = (fFormat == kJSON) ? "null" : "";
+    std::strcpy(cyclesStr, null);
+    std::strcpy(instructionsStr, null);
+    std::strcpy(ipcStr, null);
+    if (cycles >= 0) {
+      std::snprintf(cyclesStr, sizeof(cyclesStr), "%.2f", cycles / n);
+    }
+    if (instructions >= 0) {
+      std::snprintf(instructionsStr, sizeof(instructionsStr), "%.2f",
+                    instructions / n);
+    }
+    if (cycles > 0 && instructions >= 0) {
+      std::snprintf(ipcStr, sizeof(ipcStr), "%.3f", instructions / cycles);
+    }
+
+    switch (fFormat) {
+    case kText:
+      std::printf("%-48s %12.2f ns/op %14.0f op/s", name, ns, perSecond);
+      if (cycles >= 0) {
+        std::printf(" %10s cycles/op", cyclesStr);
+      }
+      if (instructions >= 0) {
+        std::printf(" %10s instr/op %6s IPC", instructionsStr, ipcStr);
+      }
+      std::printf("\n");
+      break;
+    case kCSV:
+      std::printf("%s,%llu,%.4f,%.1f,%s,%s,%s\n", name, (unsigned long long)n,
+                  ns, perSecond, cyclesStr, instructionsStr, ipcStr);
+      break;
+    case kJSON:
+      std::printf("%s\n  {\"name\": \"%s\", \"ops\": %llu, "
+                  "\"ns_per_op\": %.4f, \"ops_per_s\": %.1f, "
+                  "\"cycles_per_op\": %s, \"instructions_per_op\": %s, "
+                  "\"ipc\": %s}",
+                  fFirst ? "" : ",", name, (unsigned long long)n, ns,
+                  perSecond, cyclesStr, instructionsStr, ipcStr);
+      break;
+    }
+    fFirst = false;
+    std::fflush(stdout);
+  }
+
+  int GetRepetitions() const { return fRepetitions; }
+
+  /// Run `f(n)` repeatedly and report the fastest execution
+  template <typename F> void Run(const char *name, uint64_t n, F &&f) {
+    if (!Enabled(name)) {
+      return;
+    }
+    double best = Measure(n, f);
+    for (int i = 1; i < fRepetitions; i++) {
+      best = std::min(best, Measure(n, f));
+    }
+    Report(name, n, best);
+  }
+};
+
+#endif
@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Compare constructing engines from a catalog with SetSeed + Skip.
+
+#include <RanluxppCatalog.h>
+#include <RanluxppEngine.h>
+
+#include "bench.h"
+
+#include <cstdint>
+#include <cstdio>
+
+int main(int argc, char *argv[]) {
+  Bench bench(argc, argv);
+
+  static const char *kPath = "bench_catalog.rlxcat";
+  static constexpr uint64_t kSeed = 314159265;
+  static constexpr uint64_t kSpacing = uint64_t(1) << 40;
+  static constexpr uint64_t kCount = 10000;
+
+  if (!RanluxppCatalog::Build(kPath, kSeed, kSpacing, 0, kCount)) {
+    std::fprintf(stderr, "could not build catalog '%s'\n", kPath);
+    return 1;
+  }
+
+  bench.Run("catalog/SetSeed+Skip", kCount, [](uint64_t n) {
+    for (uint64_t i = 0; i < n; i++) {
+      RanluxppEngine engine(kSeed);
+      engine.Skip(i * kSpacing);
+      DoNotOptimize(engine);
+    }
+  });
+
+  bench.Run("catalog/Load", kCount, [](uint64_t n) {
+    RanluxppCatalog catalog(kPath);
+    RanluxppEngine engine;
+    for (uint64_t i = 0; i < n; i++) {
+      catalog.Load(i, engine);
+      DoNotOptimize(engine);
+    }
+  });
+
+  std::remove(kPath);
+  return 0;
+}
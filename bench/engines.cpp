@@ -0,0 +1,527 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Throughput of all engines and entry points, compared to the generators of
+// the C++ standard library.
+
+#include <RanluxppCompatEngine.h>
+#include <RanluxppCompatValueEngine.h>
+#include <RanluxppBernoulli.h>
+#include <RanluxppEngine.h>
+#include <RanluxppEngineArray.h>
+#include <RanluxppJump.h>
+#include <RanluxppMultiEngine.h>
+#include <RanluxppSeedCache.h>
+#include <RanluxppSplittableEngine.h>
+#include <RanluxppStreamKeys.h>
+#include <RanluxppWordEngine.h>
+
+#ifdef RANLUXPP_BENCH_CXX_STANDARD
+#include <std_ranluxpp.h>
+#endif
+
+#ifdef RANLUXPP_BENCH_GSL_INTERFACE
+#include <RanluxppGSL.h>
+#endif
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+static constexpr uint64_t kNumbers = 10000000;
+
+/// Benchmark drawing numbers from an engine constructed with its default seed
+template <class Engine>
+static void BenchRndm(Bench &bench, const std::string &name) {
+  Engine rng;
+  bench.Run((name + "/Rndm").c_str(), kNumbers, [&rng](uint64_t n) {
+    for (uint64_t i = 0; i < n; i++) {
+      DoNotOptimize(rng.Rndm());
+    }
+  });
+}
+
+/// Benchmark bulk draws of floating point numbers of type T, compared to Rndm
+template <class Engine, class T>
+static void BenchFill(Bench &bench, const std::string &name) {
+  static constexpr uint64_t kBuffer = 1024;
+  Engine rng;
+  T buffer[kBuffer];
+  bench.Run(name.c_str(), kNumbers, [&rng, &buffer](uint64_t n) {
+    for (uint64_t i = 0; i < n; i += kBuffer) {
+      rng.Fill(buffer, kBuffer);
+      DoNotOptimize(buffer);
+    }
+  });
+}
+
+/// Benchmark skipping at typical distances
+template <class Engine>
+static void BenchSkip(Bench &bench, const std::string &name) {
+  static constexpr uint64_t kDistances[] = {1, 100, 10000, 1000000000};
+  Engine rng;
+  for (uint64_t distance : kDistances) {
+    std::string skipName = name + "/Skip/" + std::to_string(distance);
+    bench.Run(skipName.c_str(), 10000, [&rng, distance](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        rng.Skip(distance);
+        DoNotOptimize(rng);
+      }
+    });
+  }
+}
+
+/// Benchmark drawing numbers round-robin from an array of engines
+template <class Engine>
+static void BenchArray(Bench &bench, const std::string &name) {
+  static constexpr int kEngines = 1024;
+  std::unique_ptr<Engine[]> engines(new Engine[kEngines]);
+  bench.Run((name + "/Array").c_str(), kNumbers, [&engines](uint64_t n) {
+    for (uint64_t i = 0; i < n; i++) {
+      DoNotOptimize(engines[i % kEngines].Rndm());
+    }
+  });
+}
+
+/// Benchmark scalar and bulk draws of an engine returning integer words
+template <class Engine>
+static void BenchWords(Bench &bench, const std::string &name) {
+  Engine rng;
+  bench.Run((name + "/IntRndm").c_str(), kNumbers, [&rng](uint64_t n) {
+    for (uint64_t i = 0; i < n; i++) {
+      DoNotOptimize(rng.IntRndm());
+    }
+  });
+
+  static constexpr uint64_t kBuffer = 1024;
+  uint64_t buffer[kBuffer];
+  bench.Run((name + "/Fill").c_str(), kNumbers, [&rng, &buffer](uint64_t n) {
+    for (uint64_t i = 0; i < n; i += kBuffer) {
+      rng.Fill(buffer, kBuffer);
+      DoNotOptimize(buffer);
+    }
+  });
+}
+
+/// Benchmark the aggregate throughput of N lanes versus N separate engines
+template <int N> static void BenchMulti(Bench &bench) {
+  static constexpr uint64_t kSeeds[] = {1, 2, 3, 4};
+  static constexpr uint64_t kBuffer = 1024;
+  std::string name = "RanluxppMultiEngine<" + std::to_string(N) + ">";
+
+  RanluxppMultiEngine<N> multi(kSeeds);
+  uint64_t buffer[N * kBuffer];
+  bench.Run((name + "/Fill").c_str(), kNumbers, [&multi, &buffer](uint64_t n) {
+    for (uint64_t i = 0; i < n; i += N * kBuffer) {
+      multi.Fill(buffer, kBuffer);
+      DoNotOptimize(buffer);
+    }
+  });
+
+  RanluxppEngine engines[N];
+  for (int l = 0; l < N; l++) {
+    engines[l].SetSeed(kSeeds[l]);
+  }
+  name = std::to_string(N) + "xRanluxppEngine";
+  bench.Run((name + "/IntRndm").c_str(), kNumbers,
+            [&engines, &buffer](uint64_t n) {
+              for (uint64_t i = 0; i < n; i += N * kBuffer) {
+                for (int l = 0; l < N; l++) {
+                  for (uint64_t j = 0; j < kBuffer; j++) {
+                    buffer[l * kBuffer + j] = engines[l].IntRndm();
+                  }
+                }
+                DoNotOptimize(buffer);
+              }
+            });
+}
+
+/// Benchmark many streams in structure-of-arrays form versus a vector of
+/// engines, per number, stream, or seed
+static void BenchEngineArray(Bench &bench) {
+  static constexpr uint64_t kStreams = 1000000;
+  static constexpr uint64_t kRounds = 24;
+
+  RanluxppEngineArray array(kStreams, 1);
+  std::vector<uint64_t> numbers(kStreams);
+  bench.Run("RanluxppEngineArray/Gather", kStreams * kRounds,
+            [&array, &numbers](uint64_t n) {
+              for (uint64_t i = 0; i < n; i += kStreams) {
+                array.Gather(numbers.data());
+                DoNotOptimize(numbers.data());
+              }
+            });
+  bench.Run("RanluxppEngineArray/Advance", kStreams, [&array](uint64_t) {
+    array.Advance();
+    DoNotOptimize(array);
+  });
+  bench.Run("RanluxppEngineArray/Skip", kStreams, [&array](uint64_t) {
+    array.Skip(1000000);
+    DoNotOptimize(array);
+  });
+  bench.Run("RanluxppEngineArray/SetSeeds", kStreams, [&array](uint64_t) {
+    array.SetSeeds(1);
+    DoNotOptimize(array);
+  });
+
+  std::vector<RanluxppEngine> engines(kStreams);
+  RanluxppEngine::SetSeeds(engines.data(), kStreams, 1);
+  bench.Run("vector<RanluxppEngine>/IntRndm", kStreams * kRounds,
+            [&engines, &numbers](uint64_t n) {
+              for (uint64_t i = 0; i < n; i += kStreams) {
+                for (uint64_t s = 0; s < kStreams; s++) {
+                  numbers[s] = engines[s].IntRndm();
+                }
+                DoNotOptimize(numbers.data());
+              }
+            });
+  RanluxppJump jump(1000000);
+  bench.Run("vector<RanluxppEngine>/RanluxppJump", kStreams,
+            [&engines, &jump](uint64_t) {
+              jump.Apply(engines.data(), kStreams);
+              DoNotOptimize(engines.data());
+            });
+}
+
+/// Benchmark a generator from the C++ standard library
+template <class Engine>
+static void BenchStd(Bench &bench, const std::string &name) {
+  Engine rng;
+  bench.Run((name + "/operator()").c_str(), kNumbers, [&rng](uint64_t n) {
+    for (uint64_t i = 0; i < n; i++) {
+      DoNotOptimize(rng());
+    }
+  });
+}
+
+int main(int argc, char *argv[]) {
+  Bench bench(argc, argv);
+
+  {
+    RanluxppEngine rng;
+    bench.Run("RanluxppEngine/Rndm", kNumbers, [&rng](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        DoNotOptimize(rng.Rndm());
+      }
+    });
+    bench.Run("RanluxppEngine/IntRndm", kNumbers, [&rng](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        DoNotOptimize(rng.IntRndm());
+      }
+    });
+
+    // A decision with probability 1/2, from a full number or a single bit
+    bench.Run("RanluxppEngine/Rndm<0.5", kNumbers, [&rng](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        DoNotOptimize(rng.Rndm() < 0.5);
+      }
+    });
+    bench.Run("RanluxppEngine/RandomBool", kNumbers, [&rng](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        DoNotOptimize(rng.RandomBool());
+      }
+    });
+    bench.Run("RanluxppEngine/NextBits/8", kNumbers, [&rng](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        DoNotOptimize(rng.NextBits(8));
+      }
+    });
+
+    static constexpr uint64_t kDistances[] = {
+        1, 12, 100, 10000, 1000000, 1000000000, uint64_t(1) << 48,
+    };
+    for (uint64_t distance : kDistances) {
+      std::string name = "RanluxppEngine/Skip/" + std::to_string(distance);
+      bench.Run(name.c_str(), 10000, [&rng, distance](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+          rng.Skip(distance);
+          DoNotOptimize(rng);
+        }
+      });
+    }
+
+    for (uint64_t distance : kDistances) {
+      std::string name = "RanluxppEngine/Rewind/" + std::to_string(distance);
+      bench.Run(name.c_str(), 10000, [&rng, distance](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+          rng.Rewind(distance);
+          DoNotOptimize(rng);
+        }
+      });
+    }
+
+    for (uint64_t distance : {uint64_t(100), uint64_t(1000000000)}) {
+      RanluxppJump jump(distance);
+      std::string name = "RanluxppJump/Apply/" + std::to_string(distance);
+      bench.Run(name.c_str(), 10000, [&rng, &jump](uint64_t n) {
+        for (uint64_t i = 0; i < n; i++) {
+          jump.Apply(rng);
+          DoNotOptimize(rng);
+        }
+      });
+    }
+
+    bench.Run("RanluxppEngine/SetSeed", 1000, [&rng](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        rng.SetSeed(i + 1);
+        DoNotOptimize(rng);
+      }
+    });
+  }
+
+  // Seeding from keys (run, event, particle): the next particle, a random
+  // particle, and a new event for every particle
+  {
+    RanluxppEngine rng;
+    RanluxppStreamKeys keys(1, 1);
+    bench.Run("RanluxppStreamKeys/Seed/next", 1000, [&rng, &keys](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        keys.Seed(rng, i);
+        DoNotOptimize(rng);
+      }
+    });
+    bench.Run("RanluxppStreamKeys/Seed/random", 1000,
+              [&rng, &keys](uint64_t n) {
+                uint64_t particle = 1;
+                for (uint64_t i = 0; i < n; i++) {
+                  particle = particle * 6364136223846793005 + 1;
+                  keys.Seed(rng, particle);
+                  DoNotOptimize(rng);
+                }
+              });
+    bench.Run("RanluxppStreamKeys/Seed/event", 1000,
+              [&rng, &keys](uint64_t n) {
+                for (uint64_t i = 0; i < n; i++) {
+                  keys.Seed(rng, 1, i + 2, i);
+                  DoNotOptimize(rng);
+                }
+              });
+  }
+
+  // Splitting engines, restarting from the root at the maximum depth, versus
+  // constructing a root
+  {
+    const RanluxppSplittableEngine root(1);
+    bench.Run("RanluxppSplittableEngine/Split", 1000, [&root](uint64_t n) {
+      RanluxppSplittableEngine parent = root;
+      for (uint64_t i = 0; i < n; i++) {
+        if (parent.Depth() == RanluxppSplittableEngine::kMaxDepth) {
+          parent = root;
+        }
+        RanluxppSplittableEngine child = parent.Split();
+        DoNotOptimize(child);
+      }
+    });
+    bench.Run("RanluxppSplittableEngine/root", 1000, [](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        RanluxppSplittableEngine rng(i + 1);
+        DoNotOptimize(rng);
+      }
+    });
+  }
+
+  // Reseeding from the seeds of 1000 channels with Zipf-distributed
+  // frequencies (exponent 1.1): SetSeed versus caches for a part of them
+  {
+    static constexpr int kChannels = 1000;
+    static constexpr uint64_t kCalls = 100000;
+    std::vector<double> cdf(kChannels);
+    double sum = 0;
+    for (int k = 0; k < kChannels; k++) {
+      sum += 1 / std::pow(k + 1, 1.1);
+      cdf[k] = sum;
+    }
+    std::mt19937_64 gen(1);
+    std::uniform_real_distribution<double> uniform(0, sum);
+    std::vector<uint64_t> seeds(kCalls);
+    for (uint64_t &seed : seeds) {
+      seed = 1000 + (std::lower_bound(cdf.begin(), cdf.end(), uniform(gen)) -
+                     cdf.begin());
+    }
+
+    RanluxppEngine rng;
+    bench.Run("RanluxppEngine/SetSeed/zipf", kCalls,
+              [&rng, &seeds](uint64_t n) {
+                for (uint64_t i = 0; i < n; i++) {
+                  rng.SetSeed(seeds[i]);
+                  DoNotOptimize(rng);
+                }
+              });
+    for (size_t capacity : {64, 256, 1000}) {
+      std::string name =
+          "RanluxppSeedCache/Seed/zipf/" + std::to_string(capacity);
+      bench.Run(name.c_str(), kCalls, [&rng, &seeds, capacity](uint64_t n) {
+        RanluxppSeedCache cache(capacity);
+        for (uint64_t i = 0; i < n; i++) {
+          cache.Seed(rng, seeds[i]);
+          DoNotOptimize(rng);
+        }
+      });
+    }
+  }
+
+  // Seeding ranges of engines with consecutive seeds, per engine
+  for (uint64_t count : {1000, 10000, 100000, 1000000}) {
+    std::vector<RanluxppEngine> engines(count);
+    std::string name = "RanluxppEngine/SetSeeds/" + std::to_string(count);
+    bench.Run(name.c_str(), count, [&engines](uint64_t n) {
+      RanluxppEngine::SetSeeds(engines.data(), n, 1);
+      DoNotOptimize(engines[n - 1]);
+    });
+  }
+
+  // Bernoulli decisions, 64 per iteration: comparisons against a uniform
+  // number versus the bit-sliced masks of RanluxppBernoulli
+  for (double p : {0.5, 0.1}) {
+    RanluxppEngine rng;
+    RanluxppBernoulli bernoulli(p);
+    std::string suffix = "/" + std::to_string(p).substr(0, 3);
+    bench.Run(("Bernoulli/Rndm<p" + suffix).c_str(), kNumbers / 64,
+              [&rng, p](uint64_t n) {
+                for (uint64_t i = 0; i < n; i++) {
+                  uint64_t mask = 0;
+                  for (int l = 0; l < 64; l++) {
+                    mask |= uint64_t(rng.Rndm() < p) << l;
+                  }
+                  DoNotOptimize(mask);
+                }
+              });
+    bench.Run(("Bernoulli/Mask" + suffix).c_str(), kNumbers / 64,
+              [&rng, &bernoulli](uint64_t n) {
+                for (uint64_t i = 0; i < n; i++) {
+                  DoNotOptimize(bernoulli.Mask(rng));
+                }
+              });
+  }
+
+  BenchWords<RanluxppEngine32>(bench, "RanluxppEngine32");
+  BenchWords<RanluxppEngine64>(bench, "RanluxppEngine64");
+
+  BenchMulti<2>(bench);
+  BenchMulti<4>(bench);
+
+  BenchEngineArray(bench);
+
+#ifdef RANLUXPP_BENCH_CXX_STANDARD
+  BenchStd<ranluxpp>(bench, "ranluxpp");
+  BenchStd<ranluxpp32>(bench, "ranluxpp32");
+  BenchStd<ranluxpp64>(bench, "ranluxpp64");
+  {
+    ranluxpp rng;
+    static constexpr uint64_t kBuffer = 1024;
+    uint64_t buffer[kBuffer];
+    bench.Run("ranluxpp/generate", kNumbers, [&rng, &buffer](uint64_t n) {
+      for (uint64_t i = 0; i < n; i += kBuffer) {
+        rng.generate(buffer, buffer + kBuffer);
+        DoNotOptimize(buffer);
+      }
+    });
+
+    std::seed_seq seq{1, 2, 3};
+    bench.Run("ranluxpp/seed(seed_seq)", 1000, [&rng, &seq](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        rng.seed(seq);
+        DoNotOptimize(rng);
+      }
+    });
+  }
+#endif
+
+#ifdef RANLUXPP_BENCH_GSL_INTERFACE
+  {
+    gsl_rng *r = gsl_rng_alloc(gsl_rng_ranluxpp);
+    bench.Run("gsl_rng_ranluxpp/get", kNumbers, [r](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        DoNotOptimize(gsl_rng_get(r));
+      }
+    });
+    bench.Run("gsl_rng_ranluxpp/uniform", kNumbers, [r](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        DoNotOptimize(gsl_rng_uniform(r));
+      }
+    });
+    bench.Run("gsl_rng_ranluxpp/fill", kNumbers, [r](uint64_t n) {
+      static constexpr uint64_t kBuffer = 1024;
+      double buffer[kBuffer];
+      for (uint64_t i = 0; i < n; i += kBuffer) {
+        gsl_rng_ranluxpp_fill(r, buffer, kBuffer);
+        DoNotOptimize(buffer);
+      }
+    });
+    bench.Run("gsl_rng_ranluxpp/skip/1000000", 10000, [r](uint64_t n) {
+      for (uint64_t i = 0; i < n; i++) {
+        gsl_rng_ranluxpp_skip(r, 1000000);
+      }
+    });
+    gsl_rng_free(r);
+  }
+#endif
+
+  BenchRndm<RanluxppCompatEngineJamesP3>(bench, "CompatJamesP3");
+  BenchRndm<RanluxppCompatEngineJamesP4>(bench, "CompatJamesP4");
+  BenchRndm<RanluxppCompatEngineGslRanlxs0>(bench, "CompatGslRanlxs0");
+  BenchRndm<RanluxppCompatEngineGslRanlxs1>(bench, "CompatGslRanlxs1");
+  BenchRndm<RanluxppCompatEngineGslRanlxs2>(bench, "CompatGslRanlxs2");
+  BenchRndm<RanluxppCompatEngineGslRanlxd1>(bench, "CompatGslRanlxd1");
+  BenchRndm<RanluxppCompatEngineGslRanlxd2>(bench, "CompatGslRanlxd2");
+  BenchRndm<RanluxppCompatEngineLuescherRanlxs0>(bench,
+                                                 "CompatLuescherRanlxs0");
+  BenchRndm<RanluxppCompatEngineLuescherRanlxs1>(bench,
+                                                 "CompatLuescherRanlxs1");
+  BenchRndm<RanluxppCompatEngineLuescherRanlxs2>(bench,
+                                                 "CompatLuescherRanlxs2");
+  BenchRndm<RanluxppCompatEngineLuescherRanlxd1>(bench,
+                                                 "CompatLuescherRanlxd1");
+  BenchRndm<RanluxppCompatEngineLuescherRanlxd2>(bench,
+                                                 "CompatLuescherRanlxd2");
+  BenchRndm<RanluxppCompatEngineStdRanlux24>(bench, "CompatStdRanlux24");
+  BenchRndm<RanluxppCompatEngineStdRanlux48>(bench, "CompatStdRanlux48");
+
+  BenchRndm<RanluxppCompatValueEngineJamesP3>(bench, "CompatValueJamesP3");
+  BenchRndm<RanluxppCompatValueEngineGslRanlxs2>(bench,
+                                                 "CompatValueGslRanlxs2");
+  BenchRndm<RanluxppCompatValueEngineGslRanlxd2>(bench,
+                                                 "CompatValueGslRanlxd2");
+  BenchRndm<RanluxppCompatValueEngineLuescherRanlxd2>(
+      bench, "CompatValueLuescherRanlxd2");
+  BenchRndm<RanluxppCompatValueEngineStdRanlux24>(bench,
+                                                  "CompatValueStdRanlux24");
+  BenchRndm<RanluxppCompatValueEngineStdRanlux48>(bench,
+                                                  "CompatValueStdRanlux48");
+
+  BenchFill<RanluxppCompatEngineJamesP3, double>(bench,
+                                                 "CompatJamesP3/Fill(double)");
+  BenchFill<RanluxppCompatEngineGslRanlxs0, double>(
+      bench, "CompatGslRanlxs0/Fill(double)");
+  BenchFill<RanluxppCompatEngineGslRanlxs0, float>(
+      bench, "CompatGslRanlxs0/Fill(float)");
+  BenchFill<RanluxppCompatEngineGslRanlxd2, double>(
+      bench, "CompatGslRanlxd2/Fill(double)");
+  BenchFill<RanluxppCompatEngineLuescherRanlxs0, double>(
+      bench, "CompatLuescherRanlxs0/Fill(double)");
+  BenchFill<RanluxppCompatEngineStdRanlux24, double>(
+      bench, "CompatStdRanlux24/Fill(double)");
+  BenchFill<RanluxppCompatValueEngineGslRanlxs2, double>(
+      bench, "CompatValueGslRanlxs2/Fill(double)");
+
+  BenchSkip<RanluxppCompatEngineGslRanlxs0>(bench, "CompatGslRanlxs0");
+  BenchSkip<RanluxppCompatEngineLuescherRanlxs0>(bench,
+                                                 "CompatLuescherRanlxs0");
+  BenchSkip<RanluxppCompatEngineLuescherRanlxd2>(bench,
+                                                 "CompatLuescherRanlxd2");
+
+  BenchArray<RanluxppCompatEngineGslRanlxd2>(bench, "CompatGslRanlxd2");
+  BenchArray<RanluxppCompatValueEngineGslRanlxd2>(bench,
+                                                  "CompatValueGslRanlxd2");
+
+  BenchStd<std::ranlux24>(bench, "std::ranlux24");
+  BenchStd<std::ranlux48>(bench, "std::ranlux48");
+  BenchStd<std::mt19937_64>(bench, "std::mt19937_64");
+
+  return 0;
+}
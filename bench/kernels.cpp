@@ -0,0 +1,54 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Per-call cycles, instructions and IPC of the arithmetic kernels, comparing
+// all variants side by side.
+
+#include "bench.h"
+#include "kernels.h"
+#include "perf_counters.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+static const KernelVariant *kVariants[] = {
+    &kKernelsInt128,
+    &kKernelsNoInt128,
+    &kKernelsLimbs32,
+};
+
+int main(int argc, char *argv[]) {
+  Bench bench(argc, argv);
+  PerfCounters counters;
+  std::fprintf(stderr, "Measuring cycles with %s\n",
+               counters.GetSourceName());
+
+  // The kernels are the same in all variants, take their names from the first.
+  const KernelVariant &first = *kVariants[0];
+  for (int k = 0; k < first.count; k++) {
+    for (const KernelVariant *variant : kVariants) {
+      const Kernel &kernel = variant->kernels[k];
+      std::string name = std::string(kernel.name) + "/" + variant->name;
+      if (!bench.Enabled(name.c_str())) {
+        continue;
+      }
+
+      // Warm up caches and branch predictors.
+      kernel.run(kernel.n / 10);
+
+      PerfCounters::Result best = {0, -1, -1};
+      for (int r = 0; r < bench.GetRepetitions(); r++) {
+        counters.Start();
+        kernel.run(kernel.n);
+        PerfCounters::Result result = counters.Stop();
+        if (r == 0 || result.seconds < best.seconds) {
+          best = result;
+        }
+      }
+      bench.Report(name.c_str(), kernel.n, best.seconds, best.cycles,
+                   best.instructions);
+    }
+  }
+
+  return 0;
+}
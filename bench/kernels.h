@@ -0,0 +1,26 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RANLUXPP_BENCH_KERNELS_H
+#define RANLUXPP_BENCH_KERNELS_H
+
+#include <cstdint>
+
+/// A kernel that can be benchmarked by calling `run(n)` for `n` invocations
+struct Kernel {
+  const char *name;
+  uint64_t n; ///< Suggested number of invocations for one measurement
+  void (*run)(uint64_t n);
+};
+
+/// All kernels, compiled with one set of preprocessor flags
+struct KernelVariant {
+  const char *name;
+  const Kernel *kernels;
+  int count;
+};
+
+extern const KernelVariant kKernelsInt128;
+extern const KernelVariant kKernelsNoInt128;
+extern const KernelVariant kKernelsLimbs32;
+
+#endif
@@ -0,0 +1,5 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#define RANLUXPP_KERNEL_VARIANT kKernelsInt128
+#define RANLUXPP_KERNEL_VARIANT_NAME "int128"
+#include "kernels.icc"
@@ -0,0 +1,7 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#define RANLUXPP_NO_INT128
+#define RANLUXPP_LIMBS32
+#define RANLUXPP_KERNEL_VARIANT kKernelsLimbs32
+#define RANLUXPP_KERNEL_VARIANT_NAME "limbs32"
+#include "kernels.icc"
@@ -0,0 +1,6 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#define RANLUXPP_NO_INT128
+#define RANLUXPP_KERNEL_VARIANT kKernelsNoInt128
+#define RANLUXPP_KERNEL_VARIANT_NAME "noint128"
+#include "kernels.icc"
@@ -0,0 +1,147 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RANLUXPP_BENCH_PERF_COUNTERS_H
+#define RANLUXPP_BENCH_PERF_COUNTERS_H
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+/// Hardware counters around a region of code
+///
+/// On Linux, cycles and retired instructions are read with perf_event_open.
+/// If that is not possible (for example because of perf_event_paranoid or in a
+/// container), cycles fall back to the time stamp counter on x86 and are not
+/// available otherwise; the elapsed wall time is always measured.
+class PerfCounters {
+
+public:
+  enum Source { kPerfEvent, kTSC, kNone };
+
+  struct Result {
+    double seconds;      ///< Elapsed wall time
+    double cycles;       ///< Elapsed cycles, negative if not available
+    double instructions; ///< Retired instructions, negative if not available
+  };
+
+private:
+  Source fSource = kNone;
+  int fCyclesFd = -1;
+  int fInstructionsFd = -1;
+
+  std::chrono::steady_clock::time_point fStart;
+  uint64_t fStartTSC = 0;
+
+#ifdef __linux__
+  static int Open(uint64_t config, int group) {
+    struct perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    attr.disabled = group < 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return syscall(SYS_perf_event_open, &attr, 0, -1, group, 0);
+  }
+#endif
+
+public:
+  PerfCounters() {
+#ifdef __linux__
+    fCyclesFd = Open(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (fCyclesFd >= 0) {
+      fInstructionsFd = Open(PERF_COUNT_HW_INSTRUCTIONS, fCyclesFd);
+    }
+    if (fCyclesFd >= 0 && fInstructionsFd >= 0) {
+      fSource = kPerfEvent;
+      return;
+    }
+    if (fCyclesFd >= 0) {
+      close(fCyclesFd);
+      fCyclesFd = -1;
+    }
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+    fSource = kTSC;
+#endif
+  }
+
+  ~PerfCounters() {
+#ifdef __linux__
+    if (fSource == kPerfEvent) {
+      close(fInstructionsFd);
+      close(fCyclesFd);
+    }
+#endif
+  }
+
+  PerfCounters(const PerfCounters &) = delete;
+  PerfCounters &operator=(const PerfCounters &) = delete;
+
+  Source GetSource() const { return fSource; }
+  const char *GetSourceName() const {
+    switch (fSource) {
+    case kPerfEvent:
+      return "perf_event";
+    case kTSC:
+      return "rdtsc";
+    default:
+      return "clock";
+    }
+  }
+
+  void Start() {
+#ifdef __linux__
+    if (fSource == kPerfEvent) {
+      ioctl(fCyclesFd, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+      ioctl(fCyclesFd, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+    }
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+    if (fSource == kTSC) {
+      fStartTSC = __rdtsc();
+    }
+#endif
+    fStart = std::chrono::steady_clock::now();
+  }
+
+  Result Stop() {
+    auto end = std::chrono::steady_clock::now();
+    Result result;
+    result.seconds = std::chrono::duration<double>(end - fStart).count();
+    result.cycles = -1;
+    result.instructions = -1;
+#if defined(__x86_64__) || defined(__i386__)
+    if (fSource == kTSC) {
+      result.cycles = __rdtsc() - fStartTSC;
+    }
+#endif
+#ifdef __linux__
+    if (fSource == kPerfEvent) {
+      ioctl(fCyclesFd, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+      // With PERF_FORMAT_GROUP: the number of events, then their values.
+      uint64_t values[3];
+      if (read(fCyclesFd, values, sizeof(values)) == sizeof(values)) {
+        result.cycles = values[1];
+        result.instructions = values[2];
+      }
+    }
+#endif
+    return result;
+  }
+};
+
+#endif
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RANLUXPP_BLOCK_H
+#define RANLUXPP_BLOCK_H
+
+#include "constants.h"
+#include "mulmod.h"
+#include "ranlux_lcg.h"
+#include "unpack.h"
+
+#include <cassert>
+#include <cstdint>
+
+// Block and position handling shared by the engines that slice each block of
+// 576 random bits into numbers of w bits. The engines keep the LCG state, the
+// numbers of the current block, and the index of the next number; counting
+// with the instrumentation is left to the callers.
+
+/// Seed the LCG state, skipping 2 ** 96 * seed blocks from the state 1
+static inline void seed_lcg(uint64_t seed, uint64_t *lcg) {
+  powermod(kA_2048_2_96, lcg, seed);
+}
+
+/// Convert the LCG state to RANLUX numbers and unpack them
+///
+/// \tparam w number of bits per number
+/// \param[in] lcg the LCG state
+/// \param[out] numbers the 576 / w numbers of the block
+template <int w>
+static void unpack_lcg(const uint64_t *lcg, uint64_t *numbers) {
+  uint64_t ranlux[9];
+  unsigned carry;
+  to_ranlux(lcg, ranlux, carry);
+  unpack<w, 576 / w>(ranlux, numbers);
+}
+
+/// Advance the LCG state by one block and start with its first number
+template <int w>
+static void advance_block(uint64_t *lcg, uint64_t *numbers, int &position) {
+  mulmod_const<kA_2048>(lcg);
+  unpack_lcg<w>(lcg, numbers);
+  position = 0;
+}
+
+/// Move the position by `n` numbers of w bits and compute the multiplier
+///
+/// \param[in] n the number of numbers to skip
+/// \param[inout] position the index of the next number in the block
+/// \param[out] a_skip the power of kA_2048 to multiply the LCG state with
+/// \return if the LCG state must be multiplied, otherwise the skip stays
+///   within the current block and a_skip is not set
+template <int w>
+static bool skip_position(uint64_t n, int &position, uint64_t *a_skip) {
+  static constexpr int kNumbers = 576 / w;
+  assert(position >= 0 && position <= kNumbers && "position out of range!");
+
+  uint64_t left = kNumbers - position;
+  if (n < left) {
+    // Just skip the next few entries in the currently available numbers.
+    position += static_cast<int>(n);
+    return false;
+  }
+
+  n -= left;
+  // Need to advance and possibly skip over blocks.
+  uint64_t skip = n / kNumbers;
+  powermod(kA_2048, a_skip, skip + 1);
+
+  // Potentially skip numbers in the freshly generated block.
+  position = static_cast<int>(n - skip * kNumbers);
+  return true;
+}
+
+/// Skip `n` numbers of w bits without generating them
+///
+/// Within the current block, only the position moves. Otherwise the LCG state
+/// is multiplied with the power of kA_2048 for all blocks at once, and only
+/// the numbers of the final block are unpacked.
+template <int w>
+static void skip_numbers(uint64_t n, uint64_t *lcg, uint64_t *numbers,
+                         int &position) {
+  uint64_t a_skip[9];
+  if (skip_position<w>(n, position, a_skip)) {
+    mulmod(a_skip, lcg);
+    unpack_lcg<w>(lcg, numbers);
+  }
+}
+
+#endif
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RANLUXPP_CONSTANTS_H
+#define RANLUXPP_CONSTANTS_H
+
+#include <cstdint>
+
+// Multipliers of the LCG equivalent to RANLUX with p = 2048, each stored as 9
+// numbers of 64 bits with the least significant first. All of them are
+// derived from the multiplier a of RANLUX with Python:
+//     >>> m = 2 ** 576 - 2 ** 240 + 1
+//     >>> a = m - (m - 1) // 2 ** 24
+//
+// The arrays are static with their initializer in the header, so that they
+// can be passed as template argument to mulmod_const in every translation
+// unit.
+
+// Advance by one block of 2048 states:
+//     >>> kA_2048 = pow(a, 2048, m)
+static const uint64_t kA_2048[] = {
+    0xed7faa90747aaad9, 0x4cec2c78af55c101, 0xe64dcb31c48228ec,
+    0x6d8a15a13bee7cb0, 0x20b2ca60cb78c509, 0x256c3d3c662ea36c,
+    0xff74e54107684ed2, 0x492edfcc0cc8e753, 0xb48c187cf5b22097,
+};
+
+// Go back by one block:
+//     >>> kA_2048_inv = pow(kA_2048, -1, m)
+static const uint64_t kA_2048_inv[] = {
+    0x66e930ce2f66364b, 0x1330d728bf2bbaa1, 0x545cb8e124ce76d2,
+    0x697585c594b4a6f0, 0x97b1cd8d680b14cb, 0xfc3810dd638ab034,
+    0x8b8512624482355f, 0x1397beb332d7f898, 0xe07cacb1ae9c6a27,
+};
+
+// Advance by 2 ** 96 blocks, the distance between the streams of two seeds:
+//     >>> kA_2048_2_96 = pow(kA_2048, 2 ** 96, m)
+static const uint64_t kA_2048_2_96[] = {
+    0x9f1c67142c84c502, 0x024d94e3c4b490e8, 0xe9d460859f0659b6,
+    0xd697d9321e8373b1, 0x1164275f61142884, 0xd644d1bd1837c737,
+    0xad4191bcf0926c6b, 0x2624a1b9ef2c42c0, 0xf671bbcee85222ab,
+};
+
+// Advance by 2 ** 98 blocks, the streams of four seeds:
+//     >>> kA_2048_2_98 = pow(kA_2048, 2 ** 98, m)
+static const uint64_t kA_2048_2_98[] = {
+    0xaad488f92d8ac1c1, 0x95d78b5f898047ae, 0x0500b7af5703794a,
+    0x7f400c455daf996d, 0x9c65ec1754d43895, 0xecb860b6eeadee3c,
+    0xc410b4781a7f30f7, 0x2c33a4cbf154a66f, 0x40c6d575b8158d9c,
+};
+
+// Advance by 2 ** 160 blocks, the events of RanluxppStreamKeys:
+//     >>> kA_2048_2_160 = pow(kA_2048, 2 ** 160, m)
+static const uint64_t kA_2048_2_160[] = {
+    0xca43af1c81e8e94b, 0xc5fe22880ae8c234, 0x189ddf58d7185780,
+    0xf7da37a35a0cd19e, 0xa88e6d460e962935, 0xffce4bf4538a5178,
+    0xe9c1041b5a22bc92, 0xb64886d6f940adc3, 0x191eda9ea14f0d10,
+};
+
+// Advance by 2 ** 224 blocks, the runs of RanluxppStreamKeys:
+//     >>> kA_2048_2_224 = pow(kA_2048, 2 ** 224, m)
+static const uint64_t kA_2048_2_224[] = {
+    0x3b8d9ad22f0c7b4d, 0x29b7ed735b9fbb4b, 0xe8d1244f044c9ec2,
+    0x3bf5dc67dd0c6902, 0x9b6e2a5ec7b42cff, 0xf2554ecfe6796bf1,
+    0xd4dc7a17ec04ae34, 0x38a5f5eb78850a60, 0xd6a54dfd4dbe53ce,
+};
+
+#endif
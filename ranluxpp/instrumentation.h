@@ -0,0 +1,119 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RANLUXPP_INSTRUMENTATION_H
+#define RANLUXPP_INSTRUMENTATION_H
+
+// Macros to update the counters of RanluxppInstrumentation.h. Without
+// RANLUXPP_INSTRUMENTATION, they expand to nothing.
+//
+//  - RANLUXPP_INSTR_COUNT(engine, counter, value) adds value to the counter
+//    of the calling thread, for example RANLUXPP_INSTR_COUNT(Engine, skips, 1)
+//  - RANLUXPP_INSTR_TIME(engine, histogram) measures the latency until the end
+//    of the enclosing scope, only with RANLUXPP_INSTRUMENTATION_TIMING
+
+#ifdef RANLUXPP_INSTRUMENTATION
+
+#include "../RanluxppInstrumentation.h"
+
+#include <atomic>
+#include <cstdint>
+
+#ifdef RANLUXPP_INSTRUMENTATION_TIMING
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#else
+#include <chrono>
+#endif
+#endif
+
+/// Add to a counter that is only written by the owning thread
+///
+/// Other threads may read the value concurrently, which is why the counter is
+/// atomic. Because there is a single writer, relaxed loads and stores suffice
+/// and compile to plain instructions without a locked read-modify-write.
+static inline void ranluxpp_count(std::atomic<uint64_t> &counter,
+                                  uint64_t value) {
+  counter.store(counter.load(std::memory_order_relaxed) + value,
+                std::memory_order_relaxed);
+}
+
+struct RanluxppAtomicHistogram {
+  std::atomic<uint64_t> counts[RanluxppLatencyHistogram::kBuckets];
+
+  void Add(uint64_t ticks) {
+    int bucket = 0;
+    while (ticks > 1 && bucket < RanluxppLatencyHistogram::kBuckets - 1) {
+      ticks >>= 1;
+      bucket++;
+    }
+    ranluxpp_count(counts[bucket], 1);
+  }
+};
+
+struct RanluxppAtomicCounters {
+  std::atomic<uint64_t> blocks;
+  std::atomic<uint64_t> numbers;
+  std::atomic<uint64_t> skips;
+  std::atomic<uint64_t> skipDistance;
+  std::atomic<uint64_t> seeds;
+
+  RanluxppAtomicHistogram advanceLatency;
+  RanluxppAtomicHistogram skipLatency;
+  RanluxppAtomicHistogram seedLatency;
+};
+
+/// Counters of one thread, registered for aggregation while the thread lives
+struct RanluxppThreadInstrumentation {
+  RanluxppAtomicCounters engines[kRanluxppInstrumentedEngines];
+
+  RanluxppThreadInstrumentation();
+  ~RanluxppThreadInstrumentation();
+
+  RanluxppAtomicCounters &operator[](RanluxppInstrumentedEngine engine) {
+    return engines[static_cast<int>(engine)];
+  }
+};
+
+extern thread_local RanluxppThreadInstrumentation gRanluxppInstrumentation;
+
+#define RANLUXPP_INSTR_COUNT(engine, counter, value)                           \
+  ranluxpp_count(                                                              \
+      gRanluxppInstrumentation[RanluxppInstrumentedEngine::engine].counter,    \
+      value)
+
+#ifdef RANLUXPP_INSTRUMENTATION_TIMING
+/// Add the latency from construction to destruction to a histogram
+class RanluxppScopeTimer {
+
+private:
+  RanluxppAtomicHistogram &fHistogram;
+  uint64_t fStart;
+
+  static uint64_t Now() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(now).count();
+#endif
+  }
+
+public:
+  RanluxppScopeTimer(RanluxppAtomicHistogram &histogram)
+      : fHistogram(histogram), fStart(Now()) {}
+  ~RanluxppScopeTimer() { fHistogram.Add(Now() - fStart); }
+};
+
+#define RANLUXPP_INSTR_TIME(engine, histogram)                                 \
+  RanluxppScopeTimer ranluxppScopeTimer(                                       \
+      gRanluxppInstrumentation[RanluxppInstrumentedEngine::engine].histogram)
+#else
+#define RANLUXPP_INSTR_TIME(engine, histogram)
+#endif
+
+#else
+#define RANLUXPP_INSTR_COUNT(engine, counter, value)
+#define RANLUXPP_INSTR_TIME(engine, histogram)
+#endif
+
+#endif
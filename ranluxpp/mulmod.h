@@ -7,13 +7,156 @@
 
 #include <cstdint>
 
+#if !defined(__SIZEOF_INT128__) || defined(RANLUXPP_NO_INT128)
+/// Multiply two 64 bit numbers given as their 32 bit halves
+///
+/// \param[in] upper1 upper 32 bits of the first factor
+/// \param[in] lower1 lower 32 bits of the first factor
+/// \param[in] upper2 upper 32 bits of the second factor
+/// \param[in] lower2 lower 32 bits of the second factor
+/// \param[out] lower_out lower 64 bits of the product
+/// \return upper 64 bits of the product
+static inline uint64_t multiply_halves(uint64_t upper1, uint64_t lower1,
+                                       uint64_t upper2, uint64_t lower2,
+                                       uint64_t &lower_out) {
+  // Multiply 32-bit parts, each product has a maximum value of
+  // (2 ** 32 - 1) ** 2 = 2 ** 64 - 2 * 2 ** 32 + 1.
+  uint64_t upper = upper1 * upper2;
+  uint64_t middle1 = upper1 * lower2;
+  uint64_t middle2 = lower1 * upper2;
+  uint64_t lower = lower1 * lower2;
+
+  // When adding the two products, the maximum value for middle is
+  // 2 * 2 ** 64 - 4 * 2 ** 32 + 2, which exceeds a uint64_t.
+  unsigned overflow;
+  uint64_t middle = add_overflow(middle1, middle2, overflow);
+  // Handling the overflow by a multiplication with 0 or 1 is cheaper
+  // than branching with an if statement, which the compiler does not
+  // optimize to this equivalent code. Note that we could do entirely
+  // without this overflow handling when summing up the intermediate
+  // products differently as described in the following SO answer:
+  //    https://stackoverflow.com/a/51587262
+  // However, this approach takes at least the same amount of thinking
+  // why a) the code gives the same results without b) overflowing due
+  // to the mixture of 32 bit arithmetic. Moreover, my tests show that
+  // the scheme implemented here is actually slightly more performant.
+  uint64_t overflow_add = overflow * (uint64_t(1) << 32);
+  // This addition can never overflow because the maximum value of upper
+  // is 2 ** 64 - 2 * 2 ** 32 + 1 (see above). When now adding another
+  // 2 ** 32, the result is 2 ** 64 - 2 ** 32 + 1 and still smaller than
+  // the maximum 2 ** 64 - 1 that can be stored in a uint64_t.
+  upper += overflow_add;
+
+  uint64_t middle_upper = middle >> 32;
+  uint64_t middle_lower = middle << 32;
+
+  lower = add_overflow(lower, middle_lower, overflow);
+  upper += overflow;
+
+  // This still can't overflow since the maximum of middle_upper is
+  //  - 2 ** 32 - 4 if there was an overflow for middle above, bringing
+  //    the maximum value of upper to 2 ** 64 - 2.
+  //  - otherwise upper still has the initial maximum value given above
+  //    and the addition of a value smaller than 2 ** 32 brings it to
+  //    a maximum value of 2 ** 64 - 2 ** 32 + 2.
+  // (Both cases include the increment to handle the overflow in lower.)
+  //
+  // All the reasoning makes perfect sense given that the product of two
+  // 64 bit numbers is smaller than or equal to
+  //     (2 ** 64 - 1) ** 2 = 2 ** 128 - 2 * 2 ** 64 + 1
+  // with the upper bits matching the 2 ** 64 - 2 of the first case.
+  upper += middle_upper;
+
+  lower_out = lower;
+  return upper;
+}
+#endif
+
+#if defined(RANLUXPP_LIMBS32)
+/// Split a 576 bit number into 18 numbers of 32 bits each
+static inline void split_limbs32(const uint64_t *in, uint32_t *out) {
+  for (int i = 0; i < 9; i++) {
+    out[2 * i] = static_cast<uint32_t>(in[i]);
+    out[2 * i + 1] = static_cast<uint32_t>(in[i] >> 32);
+  }
+}
+
+/// Multiply two 576 bit numbers, stored as 18 numbers of 32 bits each
+///
+/// \param[in] in1 first factor as 18 numbers of 32 bits each
+/// \param[in] in2 second factor as 18 numbers of 32 bits each
+/// \param[out] out result with 18 numbers of 64 bits each
+///
+/// Only uses 32 x 32 -> 64 bit products, which 32 bit targets provide natively
+/// and which need no overflow handling: the lower and upper halves of the
+/// products are summed separately for each column of 32 bits, and each sum of
+/// at most 18 halves is smaller than 18 * 2 ** 32. The carry is propagated
+/// once per column.
+static inline void multiply18x18(const uint32_t *in1, const uint32_t *in2,
+                                 uint64_t *out) {
+  uint64_t carry = 0;
+  uint64_t upperPrevious = 0;
+
+#if defined(__clang__) || defined(__INTEL_COMPILER)
+#pragma unroll
+#elif defined(__GNUC__) && __GNUC__ >= 8
+// This pragma was introduced in GCC version 8.
+#pragma GCC unroll 36
+#endif
+  for (int c = 0; c < 36; c++) {
+    uint64_t lower = 0;
+    uint64_t upper = 0;
+
+#if defined(__clang__) || defined(__INTEL_COMPILER)
+#pragma unroll
+#elif defined(__GNUC__) && __GNUC__ >= 8
+// This pragma was introduced in GCC version 8.
+#pragma GCC unroll 18
+#endif
+    for (int j = 0; j < 18; j++) {
+      int k = c - j;
+      if (k < 0 || k >= 18) {
+        continue;
+      }
+
+      uint64_t prod = static_cast<uint64_t>(in1[j]) * in2[k];
+      lower += static_cast<uint32_t>(prod);
+      upper += prod >> 32;
+    }
+
+    // The upper halves of the previous column have the weight of this one.
+    uint64_t sum = lower + upperPrevious + carry;
+    upperPrevious = upper;
+    carry = sum >> 32;
+
+    uint64_t bits = static_cast<uint32_t>(sum);
+    if (c % 2 == 0) {
+      out[c / 2] = bits;
+    } else {
+      out[c / 2] |= bits << 32;
+    }
+  }
+  // The product has 1152 bits, so there is nothing left in carry and
+  // upperPrevious.
+}
+#endif
+
 /// Multiply two 576 bit numbers, stored as 9 numbers of 64 bits each
 ///
 /// \param[in] in1 first factor as 9 numbers of 64 bits each
 /// \param[in] in2 second factor as 9 numbers of 64 bits each
 /// \param[out] out result with 18 numbers of 64 bits each
+///
+/// With RANLUXPP_LIMBS32, the numbers are split into 32 bits and multiplied
+/// with multiply18x18, regardless of whether unsigned __int128 is available.
 static void multiply9x9(const uint64_t *in1, const uint64_t *in2,
                         uint64_t *out) {
+#if defined(RANLUXPP_LIMBS32)
+  uint32_t limbs1[18], limbs2[18];
+  split_limbs32(in1, limbs1);
+  split_limbs32(in2, limbs2);
+  multiply18x18(limbs1, limbs2, out);
+#else
   uint64_t next = 0;
   unsigned nextCarry = 0;
 
@@ -51,59 +194,10 @@ static void multiply9x9(const uint64_t *in1, const uint64_t *in2,
       uint64_t upper = prod >> 64;
       uint64_t lower = static_cast<uint64_t>(prod);
 #else
-      uint64_t upper1 = fac1 >> 32;
-      uint64_t lower1 = static_cast<uint32_t>(fac1);
-
-      uint64_t upper2 = fac2 >> 32;
-      uint64_t lower2 = static_cast<uint32_t>(fac2);
-
-      // Multiply 32-bit parts, each product has a maximum value of
-      // (2 ** 32 - 1) ** 2 = 2 ** 64 - 2 * 2 ** 32 + 1.
-      uint64_t upper = upper1 * upper2;
-      uint64_t middle1 = upper1 * lower2;
-      uint64_t middle2 = lower1 * upper2;
-      uint64_t lower = lower1 * lower2;
-
-      // When adding the two products, the maximum value for middle is
-      // 2 * 2 ** 64 - 4 * 2 ** 32 + 2, which exceeds a uint64_t.
-      unsigned overflow;
-      uint64_t middle = add_overflow(middle1, middle2, overflow);
-      // Handling the overflow by a multiplication with 0 or 1 is cheaper
-      // than branching with an if statement, which the compiler does not
-      // optimize to this equivalent code. Note that we could do entirely
-      // without this overflow handling when summing up the intermediate
-      // products differently as described in the following SO answer:
-      //    https://stackoverflow.com/a/51587262
-      // However, this approach takes at least the same amount of thinking
-      // why a) the code gives the same results without b) overflowing due
-      // to the mixture of 32 bit arithmetic. Moreover, my tests show that
-      // the scheme implemented here is actually slightly more performant.
-      uint64_t overflow_add = overflow * (uint64_t(1) << 32);
-      // This addition can never overflow because the maximum value of upper
-      // is 2 ** 64 - 2 * 2 ** 32 + 1 (see above). When now adding another
-      // 2 ** 32, the result is 2 ** 64 - 2 ** 32 + 1 and still smaller than
-      // the maximum 2 ** 64 - 1 that can be stored in a uint64_t.
-      upper += overflow_add;
-
-      uint64_t middle_upper = middle >> 32;
-      uint64_t middle_lower = middle << 32;
-
-      lower = add_overflow(lower, middle_lower, overflow);
-      upper += overflow;
-
-      // This still can't overflow since the maximum of middle_upper is
-      //  - 2 ** 32 - 4 if there was an overflow for middle above, bringing
-      //    the maximum value of upper to 2 ** 64 - 2.
-      //  - otherwise upper still has the initial maximum value given above
-      //    and the addition of a value smaller than 2 ** 32 brings it to
-      //    a maximum value of 2 ** 64 - 2 ** 32 + 2.
-      // (Both cases include the increment to handle the overflow in lower.)
-      //
-      // All the reasoning makes perfect sense given that the product of two
-      // 64 bit numbers is smaller than or equal to
-      //     (2 ** 64 - 1) ** 2 = 2 ** 128 - 2 * 2 ** 64 + 1
-      // with the upper bits matching the 2 ** 64 - 2 of the first case.
-      upper += middle_upper;
+      uint64_t lower;
+      uint64_t upper = multiply_halves(fac1 >> 32, static_cast<uint32_t>(fac1),
+                                       fac2 >> 32, static_cast<uint32_t>(fac2),
+                                       lower);
 #endif
 
       // Add to current, remember carry.
@@ -117,6 +211,7 @@ static void multiply9x9(const uint64_t *in1, const uint64_t *in2,
 
     out[i] = current;
   }
+#endif
 }
 
 /// Compute a value congruent to mul modulo m less than 2 ** 576
@@ -204,11 +299,102 @@ static void mod_m(const uint64_t *mul, uint64_t *out) {
 ///
 /// The result in inout is guaranteed to be smaller than the modulus.
 static void mulmod(const uint64_t *in1, uint64_t *inout) {
-  uint64_t mul[2 * 9] = {0};
+  // multiply9x9 writes all numbers, no need to initialize.
+  uint64_t mul[2 * 9];
   multiply9x9(in1, inout, mul);
   mod_m(mul, inout);
 }
 
+/// Multiply with a constant factor modulo m
+///
+/// \tparam A first factor with 9 numbers of 64 bits each, a const array with
+///   initializer that is visible in the translation unit
+/// \param[inout] inout second factor and also the output of the same size
+///
+/// Computes the same as mulmod(A, inout), for the multipliers used in every
+/// call to advance an engine. Because A is a template argument, the compiler
+/// knows the values of the unrolled multiplication: they are encoded as
+/// immediates instead of being loaded, and without 128 bit integers (or with
+/// RANLUXPP_LIMBS32) their 32 bit halves are constants as well, while the
+/// halves of inout are split once instead of for every product. The product
+/// is only local to this function, so it can stay in registers for the
+/// reduction with mod_m.
+///
+/// The result in inout is guaranteed to be smaller than the modulus.
+template <const uint64_t *A> static void mulmod_const(uint64_t *inout) {
+  uint64_t mul[2 * 9];
+
+#if defined(RANLUXPP_LIMBS32)
+  // The split of A is folded into constants.
+  uint32_t limbs1[18], limbs2[18];
+  split_limbs32(A, limbs1);
+  split_limbs32(inout, limbs2);
+  multiply18x18(limbs1, limbs2, mul);
+#else
+#if !defined(__SIZEOF_INT128__) || defined(RANLUXPP_NO_INT128)
+  uint64_t upper2[9], lower2[9];
+  for (int k = 0; k < 9; k++) {
+    upper2[k] = inout[k] >> 32;
+    lower2[k] = static_cast<uint32_t>(inout[k]);
+  }
+#endif
+
+  uint64_t next = 0;
+  unsigned nextCarry = 0;
+
+#if defined(__clang__) || defined(__INTEL_COMPILER)
+#pragma unroll
+#elif defined(__GNUC__) && __GNUC__ >= 8
+// This pragma was introduced in GCC version 8.
+#pragma GCC unroll 18
+#endif
+  for (int i = 0; i < 18; i++) {
+    uint64_t current = next;
+    unsigned carry = nextCarry;
+
+    next = 0;
+    nextCarry = 0;
+
+#if defined(__clang__) || defined(__INTEL_COMPILER)
+#pragma unroll
+#elif defined(__GNUC__) && __GNUC__ >= 8
+// This pragma was introduced in GCC version 8.
+#pragma GCC unroll 9
+#endif
+    for (int j = 0; j < 9; j++) {
+      int k = i - j;
+      if (k < 0 || k >= 9) {
+        continue;
+      }
+
+#if defined(__SIZEOF_INT128__) && !defined(RANLUXPP_NO_INT128)
+      unsigned __int128 prod = A[j];
+      prod = prod * inout[k];
+
+      uint64_t upper = prod >> 64;
+      uint64_t lower = static_cast<uint64_t>(prod);
+#else
+      uint64_t lower;
+      uint64_t upper = multiply_halves(A[j] >> 32, static_cast<uint32_t>(A[j]),
+                                       upper2[k], lower2[k], lower);
+#endif
+
+      // Add to current, remember carry.
+      current = add_carry(current, lower, carry);
+
+      // Add to next, remember nextCarry.
+      next = add_carry(next, upper, nextCarry);
+    }
+
+    next = add_carry(next, carry, nextCarry);
+
+    mul[i] = current;
+  }
+#endif
+
+  mod_m(mul, inout);
+}
+
 /// Compute base to the n modulo m
 ///
 /// \param[in] base with 9 numbers of 64 bits each
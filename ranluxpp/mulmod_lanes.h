@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RANLUXPP_MULMOD_LANES_H
+#define RANLUXPP_MULMOD_LANES_H
+
+#include "mulmod.h"
+
+#include <cstdint>
+
+/// Multiply N independent 576 bit numbers with the same factor modulo m, SIMD
+///
+/// \param[in] in1 common factor with 9 numbers of 64 bits each
+/// \param[inout] inout N second factors and also the output, stored with the
+///   limbs interleaved as inout[i * N + lane]
+///
+/// The multiplication splits all numbers into 32 bit parts so that the inner
+/// loop over the lanes can be vectorized with 32 x 32 -> 64 bit products.
+/// Products are accumulated into column sums of their lower and upper halves,
+/// which cannot overflow, and carries are only propagated once at the end.
+/// The reduction with mod_m is done per lane. The results are identical to
+/// calling mulmod for each lane and guaranteed to be smaller than the modulus.
+template <int N>
+static void mulmod_lanes_simd(const uint64_t *in1, uint64_t *inout) {
+  uint32_t a[18];
+  for (int i = 0; i < 9; i++) {
+    a[2 * i] = static_cast<uint32_t>(in1[i]);
+    a[2 * i + 1] = static_cast<uint32_t>(in1[i] >> 32);
+  }
+  uint32_t b[18][N];
+  for (int i = 0; i < 9; i++) {
+    for (int l = 0; l < N; l++) {
+      b[2 * i][l] = static_cast<uint32_t>(inout[i * N + l]);
+      b[2 * i + 1][l] = static_cast<uint32_t>(inout[i * N + l] >> 32);
+    }
+  }
+
+  // Each column receives at most 18 lower and 18 upper halves, the sums are
+  // smaller than 36 * 2 ** 32.
+  uint64_t lower[36][N] = {};
+  uint64_t upper[36][N] = {};
+  for (int i = 0; i < 18; i++) {
+    uint64_t fac1 = a[i];
+    for (int j = 0; j < 18; j++) {
+      for (int l = 0; l < N; l++) {
+        uint64_t prod = fac1 * b[j][l];
+        lower[i + j][l] += static_cast<uint32_t>(prod);
+        upper[i + j][l] += prod >> 32;
+      }
+    }
+  }
+
+  // Propagate the carries and assemble 64 bit numbers.
+  uint64_t mul[18][N];
+  uint64_t carry[N] = {};
+  for (int c = 0; c < 36; c++) {
+    for (int l = 0; l < N; l++) {
+      uint64_t sum = lower[c][l] + carry[l];
+      if (c > 0) {
+        sum += upper[c - 1][l];
+      }
+      uint64_t bits = static_cast<uint32_t>(sum);
+      carry[l] = sum >> 32;
+      if (c % 2 == 0) {
+        mul[c / 2][l] = bits;
+      } else {
+        mul[c / 2][l] |= bits << 32;
+      }
+    }
+  }
+
+  for (int l = 0; l < N; l++) {
+    uint64_t laneMul[18], laneOut[9];
+    for (int i = 0; i < 18; i++) {
+      laneMul[i] = mul[i][l];
+    }
+    mod_m(laneMul, laneOut);
+    for (int i = 0; i < 9; i++) {
+      inout[i * N + l] = laneOut[i];
+    }
+  }
+}
+
+/// Multiply N independent 576 bit numbers with the same factor modulo m
+///
+/// \param[in] in1 common factor with 9 numbers of 64 bits each
+/// \param[inout] inout N second factors and also the output, stored with the
+///   limbs interleaved as inout[i * N + lane]
+///
+/// There are no vector instructions for 64 x 64 -> 128 bit products, and with
+/// unsigned __int128 a scalar mulmod for each lane is more than twice as fast
+/// as mulmod_lanes_simd. Without __int128, the vectorized variant only wins if
+/// the compiler may use 256 bit vectors (AVX2).
+template <int N>
+static void mulmod_lanes(const uint64_t *in1, uint64_t *inout) {
+#if (!defined(__SIZEOF_INT128__) || defined(RANLUXPP_NO_INT128)) &&            \
+    defined(__AVX2__)
+  mulmod_lanes_simd<N>(in1, inout);
+#else
+  for (int l = 0; l < N; l++) {
+    uint64_t lane[9];
+    for (int i = 0; i < 9; i++) {
+      lane[i] = inout[i * N + l];
+    }
+    mulmod(in1, lane);
+    for (int i = 0; i < 9; i++) {
+      inout[i * N + l] = lane[i];
+    }
+  }
+#endif
+}
+
+#endif
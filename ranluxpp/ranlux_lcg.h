@@ -14,7 +14,7 @@
 /// \param[in] c the carry bit of the RANLUX state
 ///
 /// \f$ m = 2^{576} - 2^{240} + 1 \f$
-static void to_lcg(const uint64_t *ranlux, unsigned c, uint64_t *lcg) {
+static inline void to_lcg(const uint64_t *ranlux, unsigned c, uint64_t *lcg) {
   unsigned carry = 0;
   // Subtract the final 240 bits.
   for (int i = 0; i < 9; i++) {
@@ -45,7 +45,8 @@ static void to_lcg(const uint64_t *ranlux, unsigned c, uint64_t *lcg) {
 /// \param[out] c the carry bit of the RANLUX state
 ///
 /// \f$ m = 2^{576} - 2^{240} + 1 \f$
-static void to_ranlux(const uint64_t *lcg, uint64_t *ranlux, unsigned &c_out) {
+static inline void to_ranlux(const uint64_t *lcg, uint64_t *ranlux,
+                             unsigned &c_out) {
   uint64_t r[9] = {0};
   int64_t c = compute_r(lcg, r);
 
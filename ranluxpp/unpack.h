@@ -0,0 +1,40 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#ifndef RANLUXPP_UNPACK_H
+#define RANLUXPP_UNPACK_H
+
+#include <cstdint>
+
+/// Unpack the first numbers of w bits from the RANLUX state
+///
+/// \param[in] ranlux the RANLUX numbers as 576 bits
+/// \param[out] numbers the first `count` numbers with w bits each
+///
+/// With the loop unrolled, all positions are known at compile time and the
+/// unpacking reduces to a fixed sequence of shifts and masks.
+template <int w, int count>
+static void unpack(const uint64_t *ranlux, uint64_t *numbers) {
+  static_assert(count * w <= 576, "not enough bits in the state");
+
+#if defined(__clang__) || defined(__INTEL_COMPILER)
+#pragma unroll
+#elif defined(__GNUC__) && __GNUC__ >= 8
+// This pragma was introduced in GCC version 8.
+#pragma GCC unroll 24
+#endif
+  for (int i = 0; i < count; i++) {
+    int position = i * w;
+    int idx = position / 64;
+    int offset = position % 64;
+    int numBits = 64 - offset;
+
+    uint64_t bits = ranlux[idx] >> offset;
+    if (numBits < w) {
+      bits |= ranlux[idx + 1] << numBits;
+    }
+    // The shift avoids undefined behavior for w = 64.
+    numbers[i] = bits & (~uint64_t(0) >> (64 - w));
+  }
+}
+
+#endif
@@ -2,91 +2,141 @@
 
 #include "std_ranluxpp.h"
 
-#include "ranluxpp/mulmod.h"
+#include "ranluxpp/block.h"
+#include "ranluxpp/instrumentation.h"
 #include "ranluxpp/ranlux_lcg.h"
+#include "ranluxpp/unpack.h"
 
-#include <cassert>
+#include <algorithm>
 #include <cstdint>
+#include <istream>
+#include <ostream>
 
-namespace {
+template <size_t __w> void ranluxpp_word_engine<__w>::seed(uint64_t __sd) {
+  RANLUXPP_INSTR_COUNT(Std, seeds, 1);
+  RANLUXPP_INSTR_TIME(Std, seedLatency);
 
-static const uint64_t kA_2048[] = {
-    0xed7faa90747aaad9, 0x4cec2c78af55c101, 0xe64dcb31c48228ec,
-    0x6d8a15a13bee7cb0, 0x20b2ca60cb78c509, 0x256c3d3c662ea36c,
-    0xff74e54107684ed2, 0x492edfcc0cc8e753, 0xb48c187cf5b22097,
-};
+  seed_lcg(__sd, fLCG);
+  unpack_lcg<word_size>(fLCG, fNumbers);
+  fPosition = 0;
+}
 
-} // end anonymous namespace
+template <size_t __w>
+void ranluxpp_word_engine<__w>::discard(unsigned long long __z) {
+  RANLUXPP_INSTR_COUNT(Std, skips, 1);
+  RANLUXPP_INSTR_COUNT(Std, skipDistance, __z);
+  RANLUXPP_INSTR_TIME(Std, skipLatency);
 
-void ranluxpp::seed(result_type __sd) {
-  uint64_t lcg[9];
-  lcg[0] = 1;
-  for (int i = 1; i < 9; i++) {
-    lcg[i] = 0;
-  }
+  skip_numbers<word_size>(__z, fLCG, fNumbers, fPosition);
+}
 
-  uint64_t a_seed[9];
-  // Skip 2 ** 96 states.
-  powermod(kA_2048, a_seed, uint64_t(1) << 48);
-  powermod(a_seed, a_seed, uint64_t(1) << 48);
-  // Skip another __sd states.
-  powermod(a_seed, a_seed, __sd);
-  mulmod(a_seed, lcg);
+template <size_t __w> void ranluxpp_word_engine<__w>::advance() {
+  RANLUXPP_INSTR_COUNT(Std, blocks, 1);
+  RANLUXPP_INSTR_TIME(Std, advanceLatency);
 
-  to_ranlux(lcg, fState, fCarry);
-  fPosition = 0;
+  advance_block<word_size>(fLCG, fNumbers, fPosition);
 }
 
-void ranluxpp::discard(unsigned long long __z) {
-  int left = (max_pos - fPosition) / word_size;
-  assert(left >= 0 && "position was out of range!");
-  if (__z < (uint64_t)left) {
-    // Just skip the next few entries in the currently available bits.
-    fPosition += __z * word_size;
-    assert(fPosition <= max_pos && "position out of range!");
-    return;
-  }
+template <size_t __w>
+typename ranluxpp_word_engine<__w>::result_type
+ranluxpp_word_engine<__w>::operator()() {
+  RANLUXPP_INSTR_COUNT(Std, numbers, 1);
 
-  __z -= left;
-  int skip = (__z / used_block);
+  if (fPosition == int(used_block)) {
+    advance();
+  }
+  return fNumbers[fPosition++];
+}
 
-  uint64_t a_skip[9];
-  powermod(kA_2048, a_skip, skip + 1);
+template <size_t __w>
+void ranluxpp_word_engine<__w>::generate(result_type *__first,
+                                         result_type *__last) {
+  RANLUXPP_INSTR_COUNT(Std, numbers, __last - __first);
+
+  while (__first != __last) {
+    if (fPosition == int(used_block)) {
+      advance();
+    }
+
+    // Copy as many numbers as possible from the current block.
+    size_t left = used_block - fPosition;
+    size_t n = std::min<size_t>(left, __last - __first);
+    const uint64_t *numbers = fNumbers + fPosition;
+    __first = std::copy(numbers, numbers + n, __first);
+    fPosition += n;
+  }
+}
 
-  uint64_t lcg[9];
-  to_lcg(fState, fCarry, lcg);
-  mulmod(a_skip, lcg);
-  to_ranlux(lcg, fState, fCarry);
+template <size_t __w>
+bool ranluxpp_word_engine<__w>::equal(const ranluxpp_word_engine &__y) const {
+  if (fPosition != __y.fPosition) {
+    // An exhausted block is equivalent to the start of the next block.
+    if (fPosition == int(used_block) && __y.fPosition == 0) {
+      ranluxpp_word_engine advanced = *this;
+      advanced.advance();
+      return advanced.equal(__y);
+    } else if (__y.fPosition == int(used_block) && fPosition == 0) {
+      return __y.equal(*this);
+    }
+    return false;
+  }
 
-  // Potentially skip numbers in the freshly generated block.
-  int remaining = __z - skip * used_block;
-  assert(remaining >= 0 && "should not end up at a negative position!");
-  fPosition = remaining * word_size;
-  assert(fPosition <= kMaxPos && "position out of range!");
+  for (int i = 0; i < 9; i++) {
+    if (fLCG[i] != __y.fLCG[i]) {
+      return false;
+    }
+  }
+  return true;
 }
 
-ranluxpp::result_type ranluxpp::operator()() {
-  if (fPosition + word_size > max_pos) {
-    // Advance the generator state.
-    uint64_t lcg[9];
-    to_lcg(fState, fCarry, lcg);
-    mulmod(kA_2048, lcg);
-    to_ranlux(lcg, fState, fCarry);
-    fPosition = 0;
+template <size_t __w>
+std::ostream &ranluxpp_word_engine<__w>::write(std::ostream &__os) const {
+  std::ios_base::fmtflags flags = __os.flags();
+  char fill = __os.fill();
+  __os.flags(std::ios_base::dec | std::ios_base::left);
+  __os.fill(' ');
+
+  uint64_t ranlux[9];
+  unsigned carry;
+  to_ranlux(fLCG, ranlux, carry);
+  for (int i = 0; i < 9; i++) {
+    __os << ranlux[i] << ' ';
   }
+  __os << carry << ' ' << fPosition;
+
+  __os.flags(flags);
+  __os.fill(fill);
+  return __os;
+}
 
-  int idx = fPosition / 64;
-  int offset = fPosition % 64;
-  size_t numBits = 64 - offset;
+template <size_t __w>
+std::istream &ranluxpp_word_engine<__w>::read(std::istream &__is) {
+  std::ios_base::fmtflags flags = __is.flags();
+  __is.flags(std::ios_base::dec | std::ios_base::skipws);
 
-  result_type bits = fState[idx] >> offset;
-  if (numBits < word_size) {
-    bits |= fState[idx + 1] << numBits;
+  uint64_t state[9];
+  unsigned carry;
+  size_t position;
+  for (int i = 0; i < 9; i++) {
+    __is >> state[i];
+  }
+  __is >> carry >> position;
+
+  if (!__is.fail()) {
+    if (carry > 1 || position > used_block) {
+      __is.setstate(std::ios_base::failbit);
+    } else {
+      // Only modify the engine if the complete state was read successfully.
+      to_lcg(state, carry, fLCG);
+      fPosition = position;
+      unpack<word_size, used_block>(state, fNumbers);
+    }
   }
-  bits &= max();
-
-  fPosition += word_size;
-  assert(fPosition <= max_pos && "position out of range!");
 
-  return bits;
+  __is.flags(flags);
+  return __is;
 }
+
+template class ranluxpp_word_engine<32>;
+template class ranluxpp_word_engine<48>;
+template class ranluxpp_word_engine<64>;
@@ -3,47 +3,138 @@
 #ifndef std_ranluxpp_h
 #define std_ranluxpp_h
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <iosfwd>
+#include <type_traits>
 
-class ranluxpp {
+/// RANLUX++ engine for the C++ standard
+///
+/// All word sizes are seeded the same and produce the same blocks of 576
+/// random bits, but slice each block into 12 words of 48 bits (ranluxpp), 18
+/// words of 32 bits, or 9 words of 64 bits. With 32 bits, result_type is
+/// uint32_t and the range matches the fast path of
+/// std::uniform_int_distribution.
+template <size_t __w> class ranluxpp_word_engine {
+  static_assert(__w == 32 || __w == 48 || __w == 64,
+                "only 32, 48, and 64 bit words are supported");
 
 public:
-  using result_type = uint64_t;
+  using result_type =
+      typename std::conditional<__w == 32, uint32_t, uint64_t>::type;
 
   static constexpr result_type default_seed = 314159265u;
 
-  // Mimick interface of std::subtract_with_carry_engine
-  static constexpr size_t word_size = 48;
+  // Mimick interface of std::subtract_with_carry_engine, the lags are those
+  // of the 48 bit words of the underlying RANLUX generator.
+  static constexpr size_t word_size = __w;
   static constexpr size_t short_lag = 5;
   static constexpr size_t long_lag = 12;
 
   // Mimick the interface of std::discard_block_engine
   static constexpr size_t block_size = 2048;
-  static constexpr size_t used_block = 12;
+  static constexpr size_t used_block = 9 * 64 / word_size;
 
   static constexpr size_t max_pos = word_size * used_block;
   static_assert(max_pos <= 9 * 64,
                 "maximum position must be smaller than size of state");
 
-  ranluxpp() : ranluxpp(default_seed) {}
-  ranluxpp(result_type __sd) { seed(__sd); }
+  ranluxpp_word_engine() : ranluxpp_word_engine(default_seed) {}
+  /// Construct with a 64 bit seed for all word sizes, as for seed(uint64_t)
+  ranluxpp_word_engine(uint64_t __sd) { seed(__sd); }
+  template <class _Sseq,
+            typename = typename std::enable_if<
+                !std::is_convertible<_Sseq, uint64_t>::value>::type>
+  explicit ranluxpp_word_engine(_Sseq &__q) {
+    seed(__q);
+  }
+
+  /// Seed the engine, the same 64 bit value for all word sizes
+  void seed(uint64_t __sd = default_seed);
 
-  void seed(result_type __sd = default_seed);
+  /// Seed from a seed sequence
+  ///
+  /// The seed sequence generates two 32 bit words that form a 64 bit seed,
+  /// which is then used as for seed(uint64_t).
+  template <class _Sseq>
+  typename std::enable_if<!std::is_convertible<_Sseq, uint64_t>::value>::type
+  seed(_Sseq &__q) {
+    uint32_t __words[2];
+    __q.generate(__words, __words + 2);
+    seed(uint64_t(__words[0]) | (uint64_t(__words[1]) << 32));
+  }
 
   static constexpr result_type min() { return 0; }
   static constexpr result_type max() {
-    return (result_type(1) << word_size) - 1;
+    return result_type(~uint64_t(0) >> (64 - word_size));
   }
 
   void discard(unsigned long long __z);
 
   result_type operator()();
 
+  /// Fill the range with the next numbers, extracting them block by block
+  void generate(result_type *__first, result_type *__last);
+
+  /// Fill the range with the next numbers, extracting them block by block
+  template <class _RandomIt>
+  void generate(_RandomIt __first, _RandomIt __last) {
+    result_type __block[used_block];
+    while (__first != __last) {
+      size_t __n = std::min<size_t>(__last - __first, used_block);
+      generate(__block, __block + __n);
+      __first = std::copy(__block, __block + __n, __first);
+    }
+  }
+
+  friend bool operator==(const ranluxpp_word_engine &__x,
+                         const ranluxpp_word_engine &__y) {
+    return __x.equal(__y);
+  }
+  friend bool operator!=(const ranluxpp_word_engine &__x,
+                         const ranluxpp_word_engine &__y) {
+    return !__x.equal(__y);
+  }
+
+  /// Write the state as 9 RANLUX words, the carry bit, and the position
+  friend std::ostream &operator<<(std::ostream &__os,
+                                  const ranluxpp_word_engine &__x) {
+    return __x.write(__os);
+  }
+  /// Read a state written by operator<<, sets failbit on invalid input
+  friend std::istream &operator>>(std::istream &__is,
+                                  ranluxpp_word_engine &__x) {
+    return __x.read(__is);
+  }
+
 private:
-  uint64_t fState[9]; ///< RANLUX state of the generator
-  unsigned fCarry;    ///< Carry bit of the RANLUX state
-  int fPosition = 0;  ///< Current position in bits
+  uint64_t fLCG[9];              ///< LCG state of the generator
+  uint64_t fNumbers[used_block]; ///< Numbers of the RANLUX state
+  int fPosition = 0;             ///< Index of the next number in fNumbers
+
+  /// Produce next block of random bits
+  void advance();
+
+  bool equal(const ranluxpp_word_engine &__y) const;
+  std::ostream &write(std::ostream &__os) const;
+  std::istream &read(std::istream &__is);
 };
 
+extern template class ranluxpp_word_engine<32>;
+extern template class ranluxpp_word_engine<48>;
+extern template class ranluxpp_word_engine<64>;
+
+/// RANLUX++ engine for the C++ standard with 48 bit words
+///
+/// A class of its own rather than an alias, so that it can still be forward
+/// declared as `class ranluxpp;`.
+class ranluxpp : public ranluxpp_word_engine<48> {
+public:
+  using ranluxpp_word_engine<48>::ranluxpp_word_engine;
+};
+
+using ranluxpp32 = ranluxpp_word_engine<32>;
+using ranluxpp64 = ranluxpp_word_engine<64>;
+
 #endif // RanluxppEngine_h
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <RanluxppBernoulli.h>
+#include <RanluxppEngine.h>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+TEST(RanluxppBernoulli, exact) {
+  static constexpr int bits = 4;
+  // Each lane l compares against U = l % 16, so all values of U are covered.
+  for (int P = 0; P <= 16; P++) {
+    RanluxppBernoulli bernoulli(P / 16.0, bits);
+    EXPECT_EQ(bernoulli.Probability(), P / 16.0);
+
+    int words = 0;
+    uint64_t mask = bernoulli.MaskFrom([&words]() {
+      // Return the bits of U from the most significant one.
+      int shift = bits - 1 - words;
+      EXPECT_GE(shift, 0);
+      words++;
+      uint64_t word = 0;
+      for (int l = 0; l < 64; l++) {
+        word |= uint64_t(((l % 16) >> shift) & 1) << l;
+      }
+      return word;
+    });
+    for (int l = 0; l < 64; l++) {
+      EXPECT_EQ((mask >> l) & 1, uint64_t((l % 16) < P)) << P << " " << l;
+    }
+
+    // Only the digits up to the last set bit of P are needed.
+    int last = 0;
+    while (P != 0 && !((P >> last) & 1)) {
+      last++;
+    }
+    EXPECT_LE(words, (P == 0 || P == 16) ? 0 : bits - last);
+  }
+}
+
+TEST(RanluxppBernoulli, half) {
+  // p = 1/2 uses one random bit per decision.
+  RanluxppBernoulli bernoulli(0.5);
+  RanluxppEngine rng(1);
+  RanluxppEngine reference(1);
+  for (int i = 0; i < 20; i++) {
+    EXPECT_EQ(bernoulli.Mask(rng), ~reference.NextBits(64));
+  }
+  EXPECT_EQ(rng.IntRndm(), reference.IntRndm());
+}
+
+TEST(RanluxppBernoulli, rounding) {
+  RanluxppBernoulli bernoulli(0.1, 8);
+  EXPECT_EQ(bernoulli.Probability(), 26 / 256.0);
+}
+
+TEST(RanluxppBernoulli, fill) {
+  RanluxppBernoulli bernoulli(0.3);
+  RanluxppEngine rng(1);
+  RanluxppEngine reference(1);
+
+  std::vector<uint64_t> masks(10000);
+  bernoulli.Fill(rng, masks.data(), masks.size());
+  uint64_t count = 0;
+  for (uint64_t mask : masks) {
+    EXPECT_EQ(mask, bernoulli.Mask(reference));
+    for (int l = 0; l < 64; l++) {
+      count += (mask >> l) & 1;
+    }
+  }
+
+  // The standard deviation of the fraction is about 0.00057.
+  double fraction = double(count) / (64 * masks.size());
+  EXPECT_NEAR(fraction, bernoulli.Probability(), 0.005);
+}
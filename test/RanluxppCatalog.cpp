@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <RanluxppCatalog.h>
+#include <RanluxppEngine.h>
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+
+static const char *kPath = "test_RanluxppCatalog.rlxcat";
+
+TEST(RanluxppCatalog, compare) {
+  // Use a spacing that is not a multiple of the numbers per block.
+  ASSERT_TRUE(RanluxppCatalog::Build(kPath, 314159265, 100, 5, 20));
+
+  RanluxppCatalog catalog(kPath);
+  ASSERT_TRUE(catalog.IsValid());
+  EXPECT_TRUE(catalog.Verify());
+  EXPECT_EQ(catalog.Seed(), 314159265);
+  EXPECT_EQ(catalog.Spacing(), 100);
+  EXPECT_EQ(catalog.First(), 5);
+  EXPECT_EQ(catalog.Count(), 20);
+  EXPECT_FALSE(catalog.Contains(4));
+  EXPECT_TRUE(catalog.Contains(5));
+  EXPECT_TRUE(catalog.Contains(24));
+  EXPECT_FALSE(catalog.Contains(25));
+
+  RanluxppEngine loaded(1);
+  for (uint64_t index = 5; index < 25; index++) {
+    RanluxppEngine reference(314159265);
+    reference.Skip(index * 100);
+
+    ASSERT_TRUE(catalog.Load(index, loaded));
+    for (int i = 0; i < 30; i++) {
+      EXPECT_EQ(loaded.IntRndm(), reference.IntRndm());
+    }
+  }
+
+  // Substreams outside of the file leave the engine unchanged.
+  RanluxppEngine expected = loaded;
+  for (uint64_t index : {uint64_t(0), uint64_t(4), uint64_t(25), UINT64_MAX}) {
+    EXPECT_FALSE(catalog.Load(index, loaded));
+  }
+  EXPECT_EQ(loaded.IntRndm(), expected.IntRndm());
+
+  std::remove(kPath);
+}
+
+TEST(RanluxppCatalog, large_spacing) {
+  static constexpr uint64_t kSpacing = uint64_t(1) << 40;
+  ASSERT_TRUE(RanluxppCatalog::Build(kPath, 1, kSpacing, 0, 4));
+
+  RanluxppCatalog catalog(kPath);
+  ASSERT_TRUE(catalog.IsValid());
+
+  RanluxppEngine reference(1);
+  for (uint64_t index = 0; index < 4; index++) {
+    RanluxppEngine engine;
+    ASSERT_TRUE(catalog.Load(index, engine));
+    RanluxppEngine copy = reference;
+    EXPECT_EQ(engine.IntRndm(), copy.IntRndm());
+    reference.Skip(kSpacing);
+  }
+
+  std::remove(kPath);
+}
+
+TEST(RanluxppCatalog, corrupt) {
+  ASSERT_TRUE(RanluxppCatalog::Build(kPath, 314159265, 12, 0, 8));
+
+  // Flip one bit in the last record.
+  FILE *file = std::fopen(kPath, "r+b");
+  ASSERT_NE(file, nullptr);
+  ASSERT_EQ(std::fseek(file, -10, SEEK_END), 0);
+  int c = std::fgetc(file);
+  ASSERT_EQ(std::fseek(file, -10, SEEK_END), 0);
+  std::fputc(c ^ 1, file);
+  std::fclose(file);
+
+  RanluxppCatalog catalog(kPath);
+  ASSERT_TRUE(catalog.IsValid());
+  EXPECT_FALSE(catalog.Verify());
+
+  // A position out of range in one record rejects the whole file.
+  static constexpr long kOffset = sizeof(RanluxppCatalogHeader) +
+                                  3 * sizeof(RanluxppCatalogRecord) +
+                                  offsetof(RanluxppCatalogRecord, position);
+  for (uint64_t position : {uint64_t(13), (uint64_t(1) << 32) + 1}) {
+    ASSERT_TRUE(RanluxppCatalog::Build(kPath, 314159265, 12, 0, 8));
+    file = std::fopen(kPath, "r+b");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(std::fseek(file, kOffset, SEEK_SET), 0);
+    std::fwrite(&position, sizeof(position), 1, file);
+    std::fclose(file);
+
+    RanluxppCatalog patched(kPath);
+    EXPECT_FALSE(patched.IsValid());
+  }
+
+  std::remove(kPath);
+}
+
+TEST(RanluxppCatalog, invalid) {
+  RanluxppCatalog missing("does-not-exist.rlxcat");
+  EXPECT_FALSE(missing.IsValid());
+  EXPECT_FALSE(missing.Verify());
+
+  // A file that is too short for the number of records in the header.
+  ASSERT_TRUE(RanluxppCatalog::Build(kPath, 314159265, 12, 0, 8));
+  FILE *file = std::fopen(kPath, "r+b");
+  ASSERT_NE(file, nullptr);
+  long offset = offsetof(RanluxppCatalogHeader, count);
+  ASSERT_EQ(std::fseek(file, offset, SEEK_SET), 0);
+  uint64_t count = 9;
+  std::fwrite(&count, sizeof(count), 1, file);
+  std::fclose(file);
+
+  RanluxppCatalog truncated(kPath);
+  EXPECT_FALSE(truncated.IsValid());
+
+  std::remove(kPath);
+}
@@ -7,6 +7,9 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdint>
+#include <vector>
+
 TEST(RanluxppCompatEngineJames, P3) {
   RanluxppCompatEngineJamesP3 rng(314159265);
 
@@ -377,6 +380,52 @@ TEST(RanluxppCompatEngineLuescherRanlxd, ranlxd2) {
   EXPECT_EQ(rng.Rndm(), 0.51160837322844798791);
 }
 
+// Skipping must be equivalent to drawing the numbers, in particular when the
+// distance ends right before, at, or right after the end of the four blocks.
+template <class Engine> static void CompareSkip(int numbersPerBlocks) {
+  const int kDistances[] = {
+      1,
+      numbersPerBlocks - 1,
+      numbersPerBlocks,
+      numbersPerBlocks + 1,
+      2 * numbersPerBlocks - 1,
+      2 * numbersPerBlocks,
+      2 * numbersPerBlocks + 1,
+      100 * numbersPerBlocks + 3,
+  };
+  for (int start = 0; start <= numbersPerBlocks; start++) {
+    for (int distance : kDistances) {
+      Engine skip(314159265);
+      Engine draw(314159265);
+      for (int i = 0; i < start; i++) {
+        skip.IntRndm();
+        draw.IntRndm();
+      }
+
+      skip.Skip(distance);
+      for (int i = 0; i < distance; i++) {
+        draw.IntRndm();
+      }
+      for (int i = 0; i < 8; i++) {
+        ASSERT_EQ(skip.IntRndm(), draw.IntRndm())
+            << "start = " << start << ", distance = " << distance;
+      }
+    }
+  }
+}
+
+TEST(RanluxppCompatEngineLuescherRanlxs, skip_boundaries) {
+  // Four blocks of 24 numbers with 24 bits each.
+  CompareSkip<RanluxppCompatEngineLuescherRanlxs0>(96);
+  CompareSkip<RanluxppCompatEngineLuescherRanlxs2>(96);
+}
+
+TEST(RanluxppCompatEngineLuescherRanlxd, skip_boundaries) {
+  // Four blocks of 12 numbers with 48 bits each.
+  CompareSkip<RanluxppCompatEngineLuescherRanlxd1>(48);
+  CompareSkip<RanluxppCompatEngineLuescherRanlxd2>(48);
+}
+
 TEST(RanluxppCompatEngineStdRanlux24, compare) {
   RanluxppCompatEngineStdRanlux24 rng(314159265);
 
@@ -442,3 +491,76 @@ TEST(RanluxppCompatEngineStdRanlux48, default) {
   rng.Skip(9999);
   EXPECT_EQ(rng.IntRndm(), 249142670248501);
 }
+
+// Filling must return the same numbers as the scalar calls, for lengths within
+// a block, up to and across its end, and over many blocks.
+template <class Engine, class T, class Draw>
+static void CompareFill(int numbersPerBlocks, Draw draw) {
+  const int kLengths[] = {
+      1,
+      numbersPerBlocks - 2,
+      1,
+      numbersPerBlocks,
+      numbersPerBlocks + 1,
+      0,
+      10 * numbersPerBlocks + 3,
+  };
+  Engine fill(314159265);
+  Engine scalar(314159265);
+  for (int n : kLengths) {
+    std::vector<T> numbers(n);
+    fill.Fill(numbers.data(), n);
+    for (int i = 0; i < n; i++) {
+      ASSERT_EQ(numbers[i], draw(scalar)) << "n = " << n << ", i = " << i;
+    }
+  }
+  EXPECT_EQ(fill.IntRndm(), scalar.IntRndm());
+}
+
+template <class Engine> static void CompareFill(int numbersPerBlocks) {
+  CompareFill<Engine, uint64_t>(numbersPerBlocks,
+                                [](Engine &rng) { return rng.IntRndm(); });
+  CompareFill<Engine, double>(numbersPerBlocks,
+                              [](Engine &rng) { return rng.Rndm(); });
+}
+
+template <class Engine> static void CompareFill24(int numbersPerBlocks) {
+  CompareFill<Engine>(numbersPerBlocks);
+  CompareFill<Engine, float>(numbersPerBlocks, [](Engine &rng) {
+    return static_cast<float>(rng.Rndm());
+  });
+}
+
+TEST(RanluxppCompatEngineJames, fill) {
+  CompareFill24<RanluxppCompatEngineJamesP3>(24);
+  CompareFill24<RanluxppCompatEngineJamesP4>(24);
+}
+
+TEST(RanluxppCompatEngineGslRanlxs, fill) {
+  CompareFill24<RanluxppCompatEngineGslRanlxs0>(24);
+  CompareFill24<RanluxppCompatEngineGslRanlxs2>(24);
+}
+
+TEST(RanluxppCompatEngineGslRanlxd, fill) {
+  CompareFill<RanluxppCompatEngineGslRanlxd1>(12);
+}
+
+TEST(RanluxppCompatEngineLuescherRanlxs, fill) {
+  // The numbers of four blocks are interleaved.
+  CompareFill24<RanluxppCompatEngineLuescherRanlxs0>(96);
+  CompareFill24<RanluxppCompatEngineLuescherRanlxs2>(96);
+}
+
+TEST(RanluxppCompatEngineLuescherRanlxd, fill) {
+  CompareFill<RanluxppCompatEngineLuescherRanlxd1>(48);
+}
+
+TEST(RanluxppCompatEngineStdRanlux24, fill) {
+  // Only 23 numbers of each block are used.
+  CompareFill24<RanluxppCompatEngineStdRanlux24>(23);
+}
+
+TEST(RanluxppCompatEngineStdRanlux48, fill) {
+  // Only 11 numbers of each block are used.
+  CompareFill<RanluxppCompatEngineStdRanlux48>(11);
+}
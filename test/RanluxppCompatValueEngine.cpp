@@ -0,0 +1,103 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <RanluxppCompatEngine.h>
+#include <RanluxppCompatValueEngine.h>
+
+#include "gtest/gtest.h"
+
+#include <type_traits>
+
+// The value engines must produce the same sequences as the engines from
+// RanluxppCompatEngine.h, which are tested against the original
+// implementations.
+template <class Engine, class ValueEngine> static void Compare(uint64_t seed) {
+  Engine rng(seed);
+  ValueEngine value(seed);
+
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(rng.IntRndm(), value.IntRndm());
+  }
+  // Skip across block boundaries and to the middle of a block.
+  rng.Skip(1000);
+  value.Skip(1000);
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(rng.Rndm(), value.Rndm());
+  }
+
+  rng.SetSeed(seed + 1);
+  value.SetSeed(seed + 1);
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(rng(), value());
+  }
+
+  // Bulk fills across block boundaries.
+  uint64_t bits[2][150];
+  rng.Fill(bits[0], 150);
+  value.Fill(bits[1], 150);
+  double floats[2][150];
+  rng.Fill(floats[0], 150);
+  value.Fill(floats[1], 150);
+  for (int i = 0; i < 150; i++) {
+    EXPECT_EQ(bits[0][i], bits[1][i]);
+    EXPECT_EQ(floats[0][i], floats[1][i]);
+  }
+}
+
+TEST(RanluxppCompatValueEngine, James) {
+  Compare<RanluxppCompatEngineJamesP3, RanluxppCompatValueEngineJamesP3>(
+      314159265);
+  Compare<RanluxppCompatEngineJamesP4, RanluxppCompatValueEngineJamesP4>(
+      314159265);
+}
+
+TEST(RanluxppCompatValueEngine, GslRanlxs) {
+  Compare<RanluxppCompatEngineGslRanlxs0, RanluxppCompatValueEngineGslRanlxs0>(
+      314159265);
+  Compare<RanluxppCompatEngineGslRanlxs1, RanluxppCompatValueEngineGslRanlxs1>(
+      314159265);
+  Compare<RanluxppCompatEngineGslRanlxs2, RanluxppCompatValueEngineGslRanlxs2>(
+      314159265);
+}
+
+TEST(RanluxppCompatValueEngine, GslRanlxd) {
+  Compare<RanluxppCompatEngineGslRanlxd1, RanluxppCompatValueEngineGslRanlxd1>(
+      314159265);
+  Compare<RanluxppCompatEngineGslRanlxd2, RanluxppCompatValueEngineGslRanlxd2>(
+      314159265);
+}
+
+TEST(RanluxppCompatValueEngine, LuescherRanlxs) {
+  Compare<RanluxppCompatEngineLuescherRanlxs0,
+          RanluxppCompatValueEngineLuescherRanlxs0>(314159265);
+  Compare<RanluxppCompatEngineLuescherRanlxs1,
+          RanluxppCompatValueEngineLuescherRanlxs1>(314159265);
+  Compare<RanluxppCompatEngineLuescherRanlxs2,
+          RanluxppCompatValueEngineLuescherRanlxs2>(314159265);
+}
+
+TEST(RanluxppCompatValueEngine, LuescherRanlxd) {
+  Compare<RanluxppCompatEngineLuescherRanlxd1,
+          RanluxppCompatValueEngineLuescherRanlxd1>(314159265);
+  Compare<RanluxppCompatEngineLuescherRanlxd2,
+          RanluxppCompatValueEngineLuescherRanlxd2>(314159265);
+}
+
+TEST(RanluxppCompatValueEngine, StdRanlux) {
+  Compare<RanluxppCompatEngineStdRanlux24,
+          RanluxppCompatValueEngineStdRanlux24>(19780503);
+  Compare<RanluxppCompatEngineStdRanlux48,
+          RanluxppCompatValueEngineStdRanlux48>(19780503);
+}
+
+TEST(RanluxppCompatValueEngine, copy) {
+  static_assert(std::is_trivially_copyable<
+                    RanluxppCompatValueEngineLuescherRanlxs0>::value,
+                "value engines must be trivially copyable");
+
+  RanluxppCompatValueEngineLuescherRanlxs0 rng(314159265);
+  rng.Skip(17);
+  RanluxppCompatValueEngineLuescherRanlxs0 copy = rng;
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(rng.IntRndm(), copy.IntRndm());
+  }
+}
@@ -7,6 +7,9 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdint>
+#include <vector>
+
 TEST(RanluxppEngine, compare) {
   RanluxppEngine rng(314159265);
 
@@ -34,3 +37,126 @@ TEST(RanluxppEngine, compare) {
   EXPECT_EQ(rng.IntRndm(), 49145148745150);
   EXPECT_EQ(rng.Rndm(), 0.74670661284082484599);
 }
+
+TEST(RanluxppEngine, skip_large) {
+  // The number of skipped blocks exceeds the range of a 32-bit integer.
+  static constexpr uint64_t n = uint64_t(1) << 40;
+  RanluxppEngine rng1(314159265);
+  RanluxppEngine rng2(314159265);
+
+  rng1.Skip(n);
+  rng2.Skip(n / 2);
+  rng2.Skip(n / 2);
+  for (int i = 0; i < 13; i++) {
+    EXPECT_EQ(rng1.IntRndm(), rng2.IntRndm());
+  }
+}
+
+TEST(RanluxppEngine, NextBits) {
+  RanluxppEngine rng(314159265);
+  RanluxppEngine reference(314159265);
+
+  // The bits of the numbers are consumed in order, across blocks.
+  static constexpr int widths[] = {1, 3, 7, 13, 48, 64, 5, 47, 2, 64, 17};
+  uint64_t buffer = 0;
+  int available = 0;
+  for (int i = 0; i < 100; i++) {
+    int k = widths[i % (sizeof(widths) / sizeof(widths[0]))];
+    uint64_t expected = 0;
+    for (int b = 0; b < k; b++) {
+      if (available == 0) {
+        buffer = reference.IntRndm();
+        available = 48;
+      }
+      expected |= (buffer & 1) << b;
+      buffer >>= 1;
+      available--;
+    }
+    EXPECT_EQ(rng.NextBits(k), expected);
+  }
+}
+
+TEST(RanluxppEngine, NextBits_mixed) {
+  RanluxppEngine rng(314159265);
+
+  // Full numbers are the same as IntRndm.
+  EXPECT_EQ(rng.NextBits(48), 39378223178113);
+
+  // IntRndm does not use the left over bits.
+  uint64_t first = rng.NextBits(1);
+  uint64_t number = rng.IntRndm();
+  RanluxppEngine reference(314159265);
+  reference.Skip(1);
+  uint64_t bits = reference.IntRndm();
+  EXPECT_EQ(first, bits & 1);
+  EXPECT_EQ(number, reference.IntRndm());
+  EXPECT_EQ(rng.NextBits(47), bits >> 1);
+
+  // Skip discards left over bits and then skips full numbers.
+  rng.RandomBool();
+  rng.Skip(1);
+  reference.Skip(2);
+  EXPECT_EQ(rng.NextBits(48), reference.IntRndm());
+}
+
+TEST(RanluxppEngine, Rewind) {
+  // Go back within the block and across blocks.
+  std::vector<uint64_t> numbers(40);
+  for (int start : {0, 5, 12}) {
+    for (uint64_t n : {1, 5, 12, 13, 40}) {
+      RanluxppEngine rng(314159265);
+      rng.Skip(start);
+      for (uint64_t i = 0; i < n; i++) {
+        numbers[i] = rng.IntRndm();
+      }
+      rng.Rewind(n);
+      for (uint64_t i = 0; i < n; i++) {
+        EXPECT_EQ(rng.IntRndm(), numbers[i]);
+      }
+    }
+  }
+
+  // Go back from the start of the first block.
+  RanluxppEngine rng(314159265);
+  rng.Rewind(25);
+  rng.Skip(25);
+  EXPECT_EQ(rng.IntRndm(), 39378223178113);
+}
+
+TEST(RanluxppEngine, Rewind_large) {
+  static constexpr uint64_t n = uint64_t(1) << 40;
+  RanluxppEngine rng1(314159265);
+  RanluxppEngine rng2(314159265);
+  rng1.IntRndm();
+  rng2.IntRndm();
+
+  // Rewind followed by Skip restores the state, and the other way around.
+  rng1.Rewind(n + 7);
+  rng1.Skip(n + 7);
+  for (int i = 0; i < 13; i++) {
+    EXPECT_EQ(rng1.IntRndm(), rng2.IntRndm());
+  }
+  rng1.Skip(n + 7);
+  rng1.Rewind(n + 7);
+  for (int i = 0; i < 13; i++) {
+    EXPECT_EQ(rng1.IntRndm(), rng2.IntRndm());
+  }
+}
+
+TEST(RanluxppEngine, SetSeeds) {
+  // Consecutive seeds, and seeds that wrap around to 0.
+  for (uint64_t first : {uint64_t(0), uint64_t(314159265), ~uint64_t(2)}) {
+    std::vector<RanluxppEngine> engines(10);
+    // Draw a number to check that the position and bits are reset.
+    engines[3].NextBits(3);
+    RanluxppEngine::SetSeeds(engines.data(), engines.size(), first);
+
+    for (size_t i = 0; i < engines.size(); i++) {
+      RanluxppEngine rng(first + i);
+      for (int j = 0; j < 13; j++) {
+        EXPECT_EQ(engines[i].IntRndm(), rng.IntRndm());
+      }
+      EXPECT_EQ(engines[i].NextBits(7), rng.NextBits(7));
+    }
+  }
+}
@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <RanluxppEngine.h>
+#include <RanluxppEngineArray.h>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+// Not a multiple of the group size, to cover the padding.
+static constexpr size_t kStreams = 10;
+static constexpr uint64_t kSeed = 314159265;
+
+static std::vector<RanluxppEngine> MakeEngines(uint64_t seed) {
+  std::vector<RanluxppEngine> engines;
+  for (size_t s = 0; s < kStreams; s++) {
+    engines.emplace_back(seed + s);
+  }
+  return engines;
+}
+
+static void CompareGather(RanluxppEngineArray &array,
+                          std::vector<RanluxppEngine> &engines, int rounds) {
+  std::vector<uint64_t> numbers(array.Size());
+  for (int r = 0; r < rounds; r++) {
+    array.Gather(numbers.data());
+    for (size_t s = 0; s < array.Size(); s++) {
+      EXPECT_EQ(numbers[s], engines[s].IntRndm());
+    }
+  }
+}
+
+TEST(RanluxppEngineArray, gather) {
+  RanluxppEngineArray array(kStreams, kSeed);
+  std::vector<RanluxppEngine> engines = MakeEngines(kSeed);
+  ASSERT_EQ(array.Size(), kStreams);
+
+  // Across several block boundaries.
+  CompareGather(array, engines, 40);
+}
+
+TEST(RanluxppEngineArray, double) {
+  RanluxppEngineArray array(kStreams, kSeed);
+  std::vector<RanluxppEngine> engines = MakeEngines(kSeed);
+
+  std::vector<double> numbers(kStreams);
+  for (int r = 0; r < 20; r++) {
+    array.Gather(numbers.data());
+    for (size_t s = 0; s < kStreams; s++) {
+      EXPECT_EQ(numbers[s], engines[s].Rndm());
+    }
+  }
+}
+
+TEST(RanluxppEngineArray, advance) {
+  RanluxppEngineArray array(kStreams, kSeed);
+  std::vector<RanluxppEngine> engines = MakeEngines(kSeed);
+  CompareGather(array, engines, 5);
+
+  // Advancing discards the rest of the current block.
+  array.Advance();
+  for (RanluxppEngine &rng : engines) {
+    rng.Skip(12 - 5);
+  }
+  CompareGather(array, engines, 3);
+
+  // Advance some streams, in an order that does not match the groups, so that
+  // the streams get out of step.
+  const size_t indices[] = {9, 2, 3, 7, 0};
+  array.Advance(indices, 5);
+  for (size_t s : indices) {
+    engines[s].Skip(12 - 3);
+  }
+  CompareGather(array, engines, 30);
+}
+
+TEST(RanluxppEngineArray, advanceRepeated) {
+  // A repeated index advances the stream once, in the same chunk of streams
+  // and across chunks.
+  for (int chunks : {1, 2}) {
+    RanluxppEngineArray array(kStreams, kSeed);
+    std::vector<RanluxppEngine> engines = MakeEngines(kSeed);
+    CompareGather(array, engines, 2);
+
+    const size_t indices[] = {3, 3, 0, 1, 2, 3, 8, 3};
+    size_t count = chunks == 1 ? 2 : 8;
+    array.Advance(indices, count);
+    for (size_t s : {0, 1, 2, 3, 8}) {
+      if (chunks == 2 || s == 3) {
+        engines[s].Skip(12 - 2);
+      }
+    }
+    CompareGather(array, engines, 30);
+  }
+}
+
+TEST(RanluxppEngineArray, skip) {
+  // Skip within a block, to the end of a block, and across blocks.
+  for (uint64_t distance : {1, 10, 11, 12, 63, 1000000}) {
+    RanluxppEngineArray array(kStreams, kSeed);
+    std::vector<RanluxppEngine> engines = MakeEngines(kSeed);
+
+    // Start at different positions within the block.
+    CompareGather(array, engines, 1);
+    const size_t indices[] = {1, 4, 5, 8};
+    array.Advance(indices, 4);
+    for (size_t s : indices) {
+      engines[s].Skip(11);
+    }
+
+    array.Skip(distance);
+    for (RanluxppEngine &rng : engines) {
+      rng.Skip(distance);
+    }
+    CompareGather(array, engines, 13);
+  }
+}
+
+TEST(RanluxppEngineArray, seed) {
+  RanluxppEngineArray array(kStreams);
+  std::vector<RanluxppEngine> engines = MakeEngines(0);
+  CompareGather(array, engines, 3);
+
+  array.SetSeeds(kSeed);
+  engines = MakeEngines(kSeed);
+  CompareGather(array, engines, 3);
+
+  array.SetSeed(3, 42);
+  engines[3].SetSeed(42);
+  CompareGather(array, engines, 3);
+}
+
+TEST(RanluxppEngineArray, seedWrap) {
+  // The seeds of the last streams wrap around to 0.
+  uint64_t seed = uint64_t(-4);
+  RanluxppEngineArray array(kStreams, seed);
+  std::vector<RanluxppEngine> engines = MakeEngines(seed);
+  CompareGather(array, engines, 15);
+}
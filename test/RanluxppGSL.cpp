@@ -3,12 +3,12 @@
 // This test uses EXPECT_EQ also for floating point numbers - the expected
 // values are entered with enough digits to ensure binary equality.
 
-#include <gsl/gsl_rng.h>
-
-extern const gsl_rng_type *gsl_rng_ranluxpp;
+#include <RanluxppGSL.h>
 
 #include "gtest/gtest.h"
 
+#include <vector>
+
 TEST(gsl_rng_ranluxpp, compare) {
   gsl_rng *r = gsl_rng_alloc(gsl_rng_ranluxpp);
   gsl_rng_set(r, 314159265);
@@ -45,3 +45,51 @@ TEST(gsl_rng_ranluxpp, compare) {
 
   gsl_rng_free(r);
 }
+
+TEST(gsl_rng_ranluxpp, skip) {
+  static constexpr int kDistances[] = {0, 1, 11, 12, 13, 23, 24, 25, 1203};
+  for (int start = 0; start <= 12; start++) {
+    for (int distance : kDistances) {
+      gsl_rng *skip = gsl_rng_alloc(gsl_rng_ranluxpp);
+      gsl_rng *draw = gsl_rng_alloc(gsl_rng_ranluxpp);
+      for (int i = 0; i < start; i++) {
+        gsl_rng_get(skip);
+        gsl_rng_get(draw);
+      }
+
+      gsl_rng_ranluxpp_skip(skip, distance);
+      for (int i = 0; i < distance; i++) {
+        gsl_rng_get(draw);
+      }
+      for (int i = 0; i < 20; i++) {
+        ASSERT_EQ(gsl_rng_get(skip), gsl_rng_get(draw))
+            << "start = " << start << ", distance = " << distance;
+      }
+
+      gsl_rng_free(skip);
+      gsl_rng_free(draw);
+    }
+  }
+}
+
+TEST(gsl_rng_ranluxpp, fill) {
+  for (size_t n : {0, 1, 5, 12, 13, 100}) {
+    for (int start = 0; start <= 12; start++) {
+      gsl_rng *fill = gsl_rng_alloc(gsl_rng_ranluxpp);
+      gsl_rng *uniform = gsl_rng_alloc(gsl_rng_ranluxpp);
+      gsl_rng_ranluxpp_skip(fill, start);
+      gsl_rng_ranluxpp_skip(uniform, start);
+
+      std::vector<double> numbers(n);
+      gsl_rng_ranluxpp_fill(fill, numbers.data(), n);
+      for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(numbers[i], gsl_rng_uniform(uniform));
+      }
+      // Both generators continue with the same number.
+      EXPECT_EQ(gsl_rng_get(fill), gsl_rng_get(uniform));
+
+      gsl_rng_free(fill);
+      gsl_rng_free(uniform);
+    }
+  }
+}
@@ -0,0 +1,116 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <RanluxppCompatEngine.h>
+#include <RanluxppEngine.h>
+#include <RanluxppInstrumentation.h>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <thread>
+
+static uint64_t sum(const RanluxppLatencyHistogram &histogram) {
+  uint64_t total = 0;
+  for (int i = 0; i < RanluxppLatencyHistogram::kBuckets; i++) {
+    total += histogram.counts[i];
+  }
+  return total;
+}
+
+TEST(RanluxppInstrumentation, RanluxppEngine) {
+  RanluxppResetCounters();
+
+  RanluxppEngine rng(1);
+  for (int i = 0; i < 25; i++) {
+    rng.IntRndm();
+  }
+  rng.Skip(100);
+  rng.SetSeed(2);
+
+  RanluxppCounters counters =
+      RanluxppGetThreadCounters(RanluxppInstrumentedEngine::Engine);
+  EXPECT_EQ(counters.seeds, 2);
+  EXPECT_EQ(counters.numbers, 25);
+  // The first block comes from seeding, 25 numbers need two more.
+  EXPECT_EQ(counters.blocks, 2);
+  EXPECT_EQ(counters.skips, 1);
+  EXPECT_EQ(counters.skipDistance, 100);
+
+#ifdef RANLUXPP_INSTRUMENTATION_TIMING
+  EXPECT_EQ(sum(counters.advanceLatency), 2);
+  EXPECT_EQ(sum(counters.skipLatency), 1);
+  EXPECT_EQ(sum(counters.seedLatency), 2);
+#else
+  EXPECT_EQ(sum(counters.advanceLatency), 0);
+#endif
+
+  // Other engines are counted separately.
+  counters = RanluxppGetThreadCounters(RanluxppInstrumentedEngine::Compat);
+  EXPECT_EQ(counters.numbers, 0);
+}
+
+TEST(RanluxppInstrumentation, RandomBool) {
+  RanluxppResetCounters();
+
+  // One bit per decision: the block from seeding has 576 of them.
+  RanluxppEngine rng(1);
+  for (int i = 0; i < 576; i++) {
+    rng.RandomBool();
+  }
+  RanluxppCounters counters =
+      RanluxppGetThreadCounters(RanluxppInstrumentedEngine::Engine);
+  EXPECT_EQ(counters.numbers, 12);
+  EXPECT_EQ(counters.blocks, 0);
+
+  rng.RandomBool();
+  counters = RanluxppGetThreadCounters(RanluxppInstrumentedEngine::Engine);
+  EXPECT_EQ(counters.blocks, 1);
+}
+
+TEST(RanluxppInstrumentation, Compat) {
+  RanluxppResetCounters();
+
+  RanluxppCompatEngineStdRanlux48 rng;
+  for (int i = 0; i < 12; i++) {
+    rng.IntRndm();
+  }
+  rng.Skip(5);
+
+  RanluxppCounters counters =
+      RanluxppGetThreadCounters(RanluxppInstrumentedEngine::Compat);
+  EXPECT_EQ(counters.seeds, 1);
+  EXPECT_EQ(counters.numbers, 12);
+  // std::ranlux48 uses 11 numbers per block.
+  EXPECT_EQ(counters.blocks, 1);
+  EXPECT_EQ(counters.skips, 1);
+  EXPECT_EQ(counters.skipDistance, 5);
+}
+
+TEST(RanluxppInstrumentation, threads) {
+  RanluxppResetCounters();
+
+  auto work = []() {
+    RanluxppEngine rng(1);
+    for (int i = 0; i < 1000; i++) {
+      rng.Rndm();
+    }
+  };
+  std::thread t1(work);
+  std::thread t2(work);
+  t1.join();
+  t2.join();
+
+  // Nothing was drawn in this thread...
+  RanluxppCounters counters =
+      RanluxppGetThreadCounters(RanluxppInstrumentedEngine::Engine);
+  EXPECT_EQ(counters.numbers, 0);
+
+  // ... but the counters of the exited threads are aggregated.
+  counters = RanluxppGetCounters(RanluxppInstrumentedEngine::Engine);
+  EXPECT_EQ(counters.seeds, 2);
+  EXPECT_EQ(counters.numbers, 2000);
+
+  RanluxppResetCounters();
+  counters = RanluxppGetCounters(RanluxppInstrumentedEngine::Engine);
+  EXPECT_EQ(counters.numbers, 0);
+}
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <RanluxppEngine.h>
+#include <RanluxppJump.h>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+
+TEST(RanluxppJump, compare) {
+  // Within the block, to the end of a block, and across blocks.
+  for (uint64_t n : {0, 1, 5, 11, 12, 13, 100, 1000000}) {
+    RanluxppJump jump(n);
+    for (int start = 0; start <= 12; start++) {
+      RanluxppEngine rng1(1);
+      RanluxppEngine rng2(1);
+      rng1.Skip(start);
+      rng2.Skip(start);
+
+      jump.Apply(rng1);
+      rng2.Skip(n);
+      for (int i = 0; i < 13; i++) {
+        EXPECT_EQ(rng1.IntRndm(), rng2.IntRndm()) << n << " " << start;
+      }
+    }
+  }
+}
+
+TEST(RanluxppJump, reuse) {
+  // Skip a fixed stride after each event.
+  RanluxppJump jump(1000);
+  RanluxppEngine rng1(1);
+  RanluxppEngine rng2(1);
+  for (int event = 0; event < 10; event++) {
+    for (int i = 0; i < event; i++) {
+      EXPECT_EQ(rng1.IntRndm(), rng2.IntRndm());
+    }
+    jump.Apply(rng1);
+    rng2.Skip(1000);
+  }
+  EXPECT_EQ(rng1.IntRndm(), rng2.IntRndm());
+
+  // Change the distance of an existing jump.
+  jump.Set(7);
+  jump.Apply(rng1);
+  rng2.Skip(7);
+  EXPECT_EQ(rng1.IntRndm(), rng2.IntRndm());
+}
+
+TEST(RanluxppJump, array) {
+  static constexpr int kEngines = 16;
+  RanluxppEngine engines[kEngines];
+  RanluxppEngine expected[kEngines];
+  for (int i = 0; i < kEngines; i++) {
+    engines[i].SetSeed(i + 1);
+    expected[i].SetSeed(i + 1);
+    // Put the engines at different positions.
+    engines[i].Skip(i);
+    expected[i].Skip(i);
+  }
+
+  RanluxppJump jump(uint64_t(1) << 40);
+  jump.Apply(engines, kEngines);
+  for (int i = 0; i < kEngines; i++) {
+    expected[i].Skip(uint64_t(1) << 40);
+    EXPECT_EQ(engines[i].IntRndm(), expected[i].IntRndm());
+  }
+}
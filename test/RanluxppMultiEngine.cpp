@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <RanluxppEngine.h>
+#include <RanluxppMultiEngine.h>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+static const uint64_t kSeeds[] = {1, 42, 314159265, 0xffffffffffffffff};
+
+template <int N> static void CompareFill() {
+  RanluxppMultiEngine<N> multi(kSeeds);
+  std::vector<RanluxppEngine> engines;
+  for (int l = 0; l < N; l++) {
+    engines.emplace_back(kSeeds[l]);
+  }
+
+  // Fill within a block, to its end, and across several blocks.
+  for (size_t n : {5, 7, 1, 30, 12}) {
+    std::vector<uint64_t> numbers(N * n);
+    multi.Fill(numbers.data(), n);
+    for (int l = 0; l < N; l++) {
+      for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(numbers[l * n + i], engines[l].IntRndm());
+      }
+    }
+  }
+}
+
+TEST(RanluxppMultiEngine, compare2) { CompareFill<2>(); }
+TEST(RanluxppMultiEngine, compare3) { CompareFill<3>(); }
+TEST(RanluxppMultiEngine, compare4) { CompareFill<4>(); }
+
+TEST(RanluxppMultiEngine, double) {
+  RanluxppMultiEngine<2> multi(kSeeds);
+  RanluxppEngine rng0(kSeeds[0]);
+  RanluxppEngine rng1(kSeeds[1]);
+
+  std::vector<double> numbers(2 * 20);
+  multi.Fill(numbers.data(), 20);
+  for (int i = 0; i < 20; i++) {
+    EXPECT_EQ(numbers[i], rng0.Rndm());
+    EXPECT_EQ(numbers[20 + i], rng1.Rndm());
+  }
+}
+
+TEST(RanluxppMultiEngine, skip) {
+  // Skip within a block, to the end of a block, and across blocks.
+  for (uint64_t distance : {1, 10, 11, 12, 63, 1000000}) {
+    RanluxppMultiEngine<3> multi(kSeeds);
+    RanluxppEngine engines[] = {kSeeds[0], kSeeds[1], kSeeds[2]};
+
+    // Start in the middle of a block.
+    uint64_t numbers[3 * 1];
+    multi.Fill(numbers, 1);
+    multi.Skip(distance);
+    for (RanluxppEngine &rng : engines) {
+      rng.Skip(1 + distance);
+    }
+
+    uint64_t next[3 * 13];
+    multi.Fill(next, 13);
+    for (int l = 0; l < 3; l++) {
+      for (int i = 0; i < 13; i++) {
+        EXPECT_EQ(next[l * 13 + i], engines[l].IntRndm());
+      }
+    }
+  }
+}
+
+TEST(RanluxppMultiEngine, seed) {
+  RanluxppMultiEngine<4> multi(kSeeds);
+  uint64_t numbers[4 * 3];
+  multi.Fill(numbers, 3);
+
+  const uint64_t seeds[] = {7, 8, 9, 10};
+  multi.SetSeeds(seeds);
+  multi.Fill(numbers, 3);
+  for (int l = 0; l < 4; l++) {
+    RanluxppEngine rng(seeds[l]);
+    for (int i = 0; i < 3; i++) {
+      EXPECT_EQ(numbers[l * 3 + i], rng.IntRndm());
+    }
+  }
+}
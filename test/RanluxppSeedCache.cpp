@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <RanluxppEngine.h>
+#include <RanluxppSeedCache.h>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+static void ExpectSeeded(RanluxppEngine &rng, uint64_t seed) {
+  RanluxppEngine expected(seed);
+  for (int i = 0; i < 25; i++) {
+    EXPECT_EQ(rng.IntRndm(), expected.IntRndm());
+  }
+}
+
+TEST(RanluxppSeedCache, seed) {
+  RanluxppSeedCache cache(4);
+  RanluxppEngine rng;
+  EXPECT_EQ(cache.Capacity(), 4);
+  EXPECT_EQ(cache.Size(), 0);
+
+  // A miss, then hits for the same seed, also after partially drawn blocks
+  // and left over bits.
+  for (int i = 0; i < 3; i++) {
+    rng.NextBits(5);
+    cache.Seed(rng, 42);
+    ExpectSeeded(rng, 42);
+  }
+  EXPECT_EQ(cache.Misses(), 1);
+  EXPECT_EQ(cache.Hits(), 2);
+  EXPECT_EQ(cache.Size(), 1);
+
+  // NextBits after seeding from the cache.
+  cache.Seed(rng, 42);
+  RanluxppEngine expected(42);
+  for (int i = 0; i < 20; i++) {
+    EXPECT_EQ(rng.NextBits(7), expected.NextBits(7));
+  }
+
+  cache.Clear();
+  EXPECT_EQ(cache.Size(), 0);
+  EXPECT_EQ(cache.Hits(), 0);
+  EXPECT_EQ(cache.Misses(), 0);
+}
+
+TEST(RanluxppSeedCache, evict) {
+  RanluxppSeedCache cache(3);
+  RanluxppEngine rng;
+  for (uint64_t seed : {1, 2, 3}) {
+    cache.Seed(rng, seed);
+  }
+  // Use 1 again, so that 2 is the least recently used seed.
+  cache.Seed(rng, 1);
+  cache.Seed(rng, 4);
+  EXPECT_EQ(cache.Size(), 3);
+  EXPECT_EQ(cache.Hits(), 1);
+  EXPECT_EQ(cache.Misses(), 4);
+
+  for (uint64_t seed : {1, 3, 4}) {
+    cache.Seed(rng, seed);
+    ExpectSeeded(rng, seed);
+  }
+  EXPECT_EQ(cache.Hits(), 4);
+
+  cache.Seed(rng, 2);
+  ExpectSeeded(rng, 2);
+  EXPECT_EQ(cache.Misses(), 5);
+  EXPECT_EQ(cache.Size(), 3);
+}
+
+TEST(RanluxppSeedCache, threads) {
+  // Several threads reseed from an overlapping working set that is larger
+  // than the cache, all results must be the same as SetSeed.
+  static constexpr int kThreads = 4;
+  static constexpr int kCalls = 2000;
+  RanluxppSeedCache cache(8);
+
+  std::vector<int> errors(kThreads);
+  auto work = [&cache, &errors](int t) {
+    RanluxppEngine rng;
+    for (int i = 0; i < kCalls; i++) {
+      uint64_t seed = (i * 7 + t) % 12;
+      cache.Seed(rng, seed);
+      RanluxppEngine expected(seed);
+      if (rng.IntRndm() != expected.IntRndm()) {
+        errors[t]++;
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.emplace_back(work, t);
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+
+  for (int t = 0; t < kThreads; t++) {
+    EXPECT_EQ(errors[t], 0);
+  }
+  EXPECT_EQ(cache.Hits() + cache.Misses(), kThreads * kCalls);
+  EXPECT_LE(cache.Size(), 8);
+}
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <RanluxppEngine.h>
+#include <RanluxppSplittableEngine.h>
+#include <RanluxppStreamKeys.h>
+
+#include "../ranluxpp/constants.h"
+#include "../ranluxpp/mulmod.h"
+#include "../ranluxpp/ranlux_lcg.h"
+#include "../ranluxpp/unpack.h"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <set>
+#include <utility>
+#include <vector>
+
+/// Compute kA_2048 ** (2 ** k) independently, in steps of 32 bits
+static void Power(int k, uint64_t *a) {
+  powermod(kA_2048, a, 1);
+  for (; k >= 32; k -= 32) {
+    powermod(a, a, uint64_t(1) << 32);
+  }
+  powermod(a, a, uint64_t(1) << k);
+}
+
+/// Compare the first block of `rng` with the block of the LCG state `lcg`
+static void ExpectState(RanluxppSplittableEngine &rng, const uint64_t *lcg) {
+  uint64_t ranlux[9];
+  unsigned carry;
+  to_ranlux(lcg, ranlux, carry);
+  uint64_t numbers[12];
+  unpack<48, 12>(ranlux, numbers);
+  for (int i = 0; i < 12; i++) {
+    EXPECT_EQ(rng.IntRndm(), numbers[i]);
+  }
+}
+
+static void ExpectSame(RanluxppSplittableEngine &rng,
+                       RanluxppEngine &expected) {
+  for (int i = 0; i < 25; i++) {
+    EXPECT_EQ(rng.IntRndm(), expected.IntRndm());
+  }
+}
+
+TEST(RanluxppSplittableEngine, root) {
+  // The root for seed 0 starts from the state 1, the same as SetSeed(0).
+  RanluxppSplittableEngine root0(0);
+  RanluxppEngine expected(0);
+  EXPECT_EQ(root0.Depth(), 0);
+  ExpectSame(root0, expected);
+
+  uint64_t a[9];
+  Power(480, a);
+  RanluxppSplittableEngine root1(1);
+  ExpectState(root1, a);
+
+  uint64_t lcg[9];
+  powermod(a, lcg, 1);
+  mulmod(a, lcg);
+  RanluxppSplittableEngine root2(2);
+  ExpectState(root2, lcg);
+
+  powermod(a, lcg, UINT64_MAX);
+  RanluxppSplittableEngine rootMax(UINT64_MAX);
+  ExpectState(rootMax, lcg);
+}
+
+TEST(RanluxppSplittableEngine, parentChain) {
+  // Splitting the same engine until the maximum depth: the parent continues
+  // its stream, and the child of depth d starts 2 ** (479 - d) blocks later.
+  RanluxppSplittableEngine parent(0);
+  RanluxppEngine expected(0);
+  std::vector<RanluxppSplittableEngine> children;
+  for (int d = 0; d < RanluxppSplittableEngine::kMaxDepth; d++) {
+    children.push_back(parent.Split());
+    EXPECT_EQ(parent.Depth(), d + 1);
+    EXPECT_EQ(children.back().Depth(), d + 1);
+    EXPECT_EQ(parent.IntRndm(), expected.IntRndm());
+  }
+
+  for (int d : {0, 1, 100, 200, 381}) {
+    uint64_t a[9];
+    Power(479 - d, a);
+    ExpectState(children[d], a);
+  }
+
+  // The deepest children match seeding and keys.
+  RanluxppEngine seed1(1), seed2(2);
+  ExpectSame(children[383], seed1);
+  ExpectSame(children[382], seed2);
+
+  RanluxppStreamKeys keys;
+  RanluxppEngine key;
+  keys.Seed(key, 0, 1, 0);
+  ExpectSame(children[319], key);
+  keys.Seed(key, 1, 0, 0);
+  ExpectSame(children[255], key);
+}
+
+TEST(RanluxppSplittableEngine, childChain) {
+  // Always continue with the child: after splitting the root 352 times, the
+  // chain of 32 children ends at 2 ** 127 + ... + 2 ** 96 blocks, which is the
+  // stream of SetSeed(2 ** 32 - 1).
+  RanluxppSplittableEngine rng(0);
+  for (int d = 0; d < 352; d++) {
+    rng.Split();
+  }
+  for (int d = 352; d < RanluxppSplittableEngine::kMaxDepth; d++) {
+    rng = rng.Split();
+  }
+  EXPECT_EQ(rng.Depth(), RanluxppSplittableEngine::kMaxDepth);
+
+  RanluxppEngine expected((uint64_t(1) << 32) - 1);
+  ExpectSame(rng, expected);
+}
+
+/// Grow a tree of `count` engines by splitting pseudo-randomly chosen ones
+static std::vector<RanluxppSplittableEngine> GrowTree(size_t count) {
+  std::vector<RanluxppSplittableEngine> engines{RanluxppSplittableEngine(1)};
+  engines.reserve(count);
+  uint64_t choice = 1;
+  while (engines.size() < count) {
+    choice = choice * 6364136223846793005 + 1442695040888963407;
+    // First a chain of children down to the maximum depth, then split any
+    // engine.
+    size_t n = engines.size();
+    size_t pick = n - 1;
+    if (n > RanluxppSplittableEngine::kMaxDepth) {
+      pick = (choice >> 20) % n;
+    }
+    if (engines[pick].Depth() < RanluxppSplittableEngine::kMaxDepth) {
+      engines.push_back(engines[pick].Split());
+    }
+  }
+  return engines;
+}
+
+TEST(RanluxppSplittableEngine, tree) {
+  // All engines must be distinct, down to the maximum depth along some paths.
+  std::vector<RanluxppSplittableEngine> engines = GrowTree(3000);
+  int maxDepth = 0;
+  std::set<std::pair<uint64_t, uint64_t>> first;
+  for (RanluxppSplittableEngine &rng : engines) {
+    maxDepth = std::max(maxDepth, rng.Depth());
+    uint64_t r0 = rng.IntRndm();
+    uint64_t r1 = rng.IntRndm();
+    EXPECT_TRUE(first.insert({r0, r1}).second);
+  }
+  EXPECT_EQ(maxDepth, RanluxppSplittableEngine::kMaxDepth);
+
+  // The same sequence of splits produces the same engines.
+  std::vector<RanluxppSplittableEngine> again = GrowTree(3000);
+  for (size_t i = 0; i < engines.size(); i++) {
+    EXPECT_EQ(engines[i].Depth(), again[i].Depth());
+    again[i].IntRndm();
+    again[i].IntRndm();
+    EXPECT_EQ(engines[i].IntRndm(), again[i].IntRndm());
+  }
+}
@@ -0,0 +1,87 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <RanluxppEngine.h>
+#include <RanluxppStreamKeys.h>
+
+#include "../ranluxpp/constants.h"
+#include "../ranluxpp/mulmod.h"
+#include "../ranluxpp/ranlux_lcg.h"
+#include "../ranluxpp/unpack.h"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+
+/// Compare the first block of `rng` with the state for the key, computed
+/// independently from kA_2048 by repeated squaring
+static void ExpectKey(RanluxppEngine &rng, uint64_t run, uint64_t event,
+                      uint64_t particle) {
+  // a = kA_2048 ** (2 ** 96), the multiplier between particles
+  uint64_t a[9];
+  powermod(kA_2048, a, uint64_t(1) << 48);
+  powermod(a, a, uint64_t(1) << 48);
+
+  uint64_t lcg[9];
+  powermod(a, lcg, particle);
+  for (uint64_t index : {event, run}) {
+    // Move a to the next level, 2 ** 64 times further.
+    powermod(a, a, uint64_t(1) << 32);
+    powermod(a, a, uint64_t(1) << 32);
+    uint64_t level[9];
+    powermod(a, level, index);
+    mulmod(level, lcg);
+  }
+
+  uint64_t ranlux[9];
+  unsigned carry;
+  to_ranlux(lcg, ranlux, carry);
+  uint64_t numbers[12];
+  unpack<48, 12>(ranlux, numbers);
+  for (int i = 0; i < 12; i++) {
+    EXPECT_EQ(rng.IntRndm(), numbers[i]);
+  }
+}
+
+TEST(RanluxppStreamKeys, SetSeed) {
+  // The key (0, 0, s) is the same stream as SetSeed(s), in sequence and with
+  // random access.
+  RanluxppStreamKeys keys;
+  RanluxppEngine rng;
+  for (uint64_t particle : {0, 1, 2, 3, 314159265, 7, 7, 8}) {
+    keys.Seed(rng, particle);
+    RanluxppEngine expected(particle);
+    for (int i = 0; i < 25; i++) {
+      EXPECT_EQ(rng.IntRndm(), expected.IntRndm());
+    }
+  }
+}
+
+TEST(RanluxppStreamKeys, levels) {
+  const uint64_t max = UINT64_MAX;
+  const uint64_t keys[][3] = {
+      {0, 1, 0},   {0, 1, 1},     {0, 2, 5},   {1, 0, 0},
+      {1, 0, 1},   {3, 4, 5},     {3, 5, 5},   {3, 6, 0},
+      {0, 0, max}, {0, max, max}, {max, 0, 0},
+  };
+
+  RanluxppStreamKeys streams;
+  RanluxppEngine rng;
+  for (const uint64_t *key : keys) {
+    streams.Seed(rng, key[0], key[1], key[2]);
+    ExpectKey(rng, key[0], key[1], key[2]);
+  }
+
+  // Same results after SetRun and SetEvent, including the next event and
+  // particle after the largest index.
+  streams.SetRun(3, 4);
+  streams.SetEvent(5);
+  streams.Seed(rng, 5);
+  ExpectKey(rng, 3, 5, 5);
+  streams.Seed(rng, max);
+  streams.Seed(rng, 0);
+  ExpectKey(rng, 3, 5, 0);
+  streams.SetEvent(max);
+  streams.SetEvent(0);
+  streams.Seed(rng, 1);
+  ExpectKey(rng, 3, 0, 1);
+}
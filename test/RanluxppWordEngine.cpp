@@ -0,0 +1,115 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#include <RanluxppEngine.h>
+#include <RanluxppWordEngine.h>
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <vector>
+
+/// Assemble the 576 bits of the next block from the 48 bit numbers
+static void NextBlock(RanluxppEngine &rng, uint64_t *bits) {
+  for (int i = 0; i < 9; i++) {
+    bits[i] = 0;
+  }
+  for (int i = 0; i < 12; i++) {
+    uint64_t number = rng.IntRndm();
+    int position = i * 48;
+    int idx = position / 64;
+    int offset = position % 64;
+    bits[idx] |= number << offset;
+    if (offset > 64 - 48) {
+      bits[idx + 1] |= number >> (64 - offset);
+    }
+  }
+}
+
+TEST(RanluxppWordEngine, compare64) {
+  RanluxppEngine rng(314159265);
+  RanluxppEngine64 rng64(314159265);
+
+  // The 64 bit words slice the same blocks as the 48 bit numbers.
+  for (int b = 0; b < 3; b++) {
+    uint64_t bits[9];
+    NextBlock(rng, bits);
+    for (int i = 0; i < 9; i++) {
+      EXPECT_EQ(rng64.IntRndm(), bits[i]);
+    }
+  }
+}
+
+TEST(RanluxppWordEngine, compare32) {
+  RanluxppEngine rng(314159265);
+  RanluxppEngine32 rng32(314159265);
+
+  for (int b = 0; b < 3; b++) {
+    uint64_t bits[9];
+    NextBlock(rng, bits);
+    for (int i = 0; i < 9; i++) {
+      EXPECT_EQ(rng32.IntRndm(), bits[i] & 0xffffffff);
+      EXPECT_EQ(rng32.IntRndm(), bits[i] >> 32);
+    }
+  }
+}
+
+TEST(RanluxppWordEngine, range) {
+  EXPECT_EQ(RanluxppEngine32::Min(), 0);
+  EXPECT_EQ(RanluxppEngine32::Max(), 0xffffffff);
+  EXPECT_EQ(RanluxppEngine64::Min(), 0);
+  EXPECT_EQ(RanluxppEngine64::Max(), 0xffffffffffffffff);
+
+  // With 32 bit words, the upper half must be empty.
+  RanluxppEngine32 rng32;
+  for (int i = 0; i < 100; i++) {
+    EXPECT_LE(rng32.IntRndm(), RanluxppEngine32::Max());
+  }
+}
+
+template <class Engine> static void CompareSkip(int numbersPerBlock) {
+  // Skip within a block, to the end of a block, and across blocks.
+  const uint64_t distances[] = {
+      1,
+      uint64_t(numbersPerBlock - 1),
+      uint64_t(numbersPerBlock),
+      uint64_t(numbersPerBlock + 1),
+      uint64_t(5 * numbersPerBlock + 3),
+  };
+
+  for (uint64_t distance : distances) {
+    Engine rng1(42);
+    Engine rng2(42);
+    // Start in the middle of a block.
+    rng1.IntRndm();
+    rng2.IntRndm();
+
+    rng1.Skip(distance);
+    for (uint64_t i = 0; i < distance; i++) {
+      rng2.IntRndm();
+    }
+    for (int i = 0; i < numbersPerBlock + 1; i++) {
+      EXPECT_EQ(rng1.IntRndm(), rng2.IntRndm());
+    }
+  }
+}
+
+TEST(RanluxppWordEngine, skip32) { CompareSkip<RanluxppEngine32>(18); }
+TEST(RanluxppWordEngine, skip64) { CompareSkip<RanluxppEngine64>(9); }
+
+template <class Engine> static void CompareFill() {
+  Engine rng1(42);
+  Engine rng2(42);
+
+  // Fill across block boundaries, starting in the middle of a block.
+  std::vector<uint64_t> numbers(50);
+  rng1.IntRndm();
+  rng2.IntRndm();
+  rng1.Fill(numbers.data(), numbers.size());
+  for (uint64_t number : numbers) {
+    EXPECT_EQ(number, rng2.IntRndm());
+  }
+  EXPECT_EQ(rng1.IntRndm(), rng2.IntRndm());
+}
+
+TEST(RanluxppWordEngine, fill32) { CompareFill<RanluxppEngine32>(); }
+TEST(RanluxppWordEngine, fill64) { CompareFill<RanluxppEngine64>(); }
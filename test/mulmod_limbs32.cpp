@@ -0,0 +1,4 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+#define RANLUXPP_LIMBS32
+#include "mulmod.icc"
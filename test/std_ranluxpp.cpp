@@ -7,7 +7,13 @@
 
 #include "gtest/gtest.h"
 
+#include <cstdint>
 #include <random>
+#include <sstream>
+#include <vector>
+
+// ranluxpp must remain a class that can be forward declared.
+class ranluxpp;
 
 TEST(std_ranluxpp, compare) {
   ranluxpp rng(314159265);
@@ -45,6 +51,101 @@ TEST(std_ranluxpp, seed) {
   EXPECT_EQ(rng(), 39378223178113);
 }
 
+TEST(std_ranluxpp, seed_seq) {
+  std::seed_seq seq{1, 2, 3};
+  ranluxpp rng(seq);
+
+  // The seed sequence generates two words for a 64 bit seed.
+  uint32_t words[2];
+  seq.generate(words, words + 2);
+  ranluxpp expected(uint64_t(words[0]) | (uint64_t(words[1]) << 32));
+  EXPECT_EQ(rng, expected);
+
+  rng.seed(1);
+  EXPECT_NE(rng, expected);
+  rng.seed(seq);
+  EXPECT_EQ(rng, expected);
+
+  // Seeding with an integer lvalue must not be mistaken for a seed sequence.
+  int seed = 314159265;
+  rng.seed(seed);
+  EXPECT_EQ(rng(), 39378223178113);
+}
+
+TEST(std_ranluxpp, equal) {
+  ranluxpp rng1(1);
+  ranluxpp rng2(1);
+  EXPECT_EQ(rng1, rng2);
+
+  rng1();
+  EXPECT_NE(rng1, rng2);
+  rng2.discard(1);
+  EXPECT_EQ(rng1, rng2);
+
+  // An exhausted block compares equal to the start of the next block, which
+  // discard moves to when reaching the end of the current block.
+  for (int i = 0; i < 11; i++) {
+    rng1();
+  }
+  rng2.discard(11);
+  EXPECT_EQ(rng1, rng2);
+  EXPECT_EQ(rng2, rng1);
+  EXPECT_EQ(rng1(), rng2());
+
+  ranluxpp rng3(2);
+  EXPECT_NE(rng1, rng3);
+}
+
+TEST(std_ranluxpp, stream) {
+  ranluxpp rng(1);
+  rng.discard(17);
+
+  std::stringstream ss;
+  ss << std::hex << rng;
+  // The flags of the stream must be restored.
+  EXPECT_TRUE(ss.flags() & std::ios_base::hex);
+
+  ranluxpp restored;
+  ss >> restored;
+  EXPECT_FALSE(ss.fail());
+  EXPECT_EQ(rng, restored);
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(rng(), restored());
+  }
+
+  // Invalid input does not modify the engine.
+  std::stringstream invalid("1 2 3 4 5 6 7 8 9 2 0");
+  ranluxpp unchanged = restored;
+  invalid >> restored;
+  EXPECT_TRUE(invalid.fail());
+  EXPECT_EQ(restored, unchanged);
+}
+
+TEST(std_ranluxpp, generate) {
+  for (size_t n : {0, 1, 5, 12, 13, 100}) {
+    for (int start = 0; start <= 12; start++) {
+      ranluxpp rng(1);
+      ranluxpp scalar(1);
+      rng.discard(start);
+      scalar.discard(start);
+
+      std::vector<uint64_t> numbers(n);
+      rng.generate(numbers.data(), numbers.data() + n);
+      for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(numbers[i], scalar());
+      }
+      EXPECT_EQ(rng, scalar);
+
+      // Iterators that are not pointers go through a buffer.
+      rng.generate(numbers.begin(), numbers.end());
+      for (size_t i = 0; i < n; i++) {
+        EXPECT_EQ(numbers[i], scalar());
+      }
+      EXPECT_EQ(rng, scalar);
+    }
+  }
+}
+
 template <class Engine> void test_distributions() {
   Engine e;
 
@@ -59,3 +160,82 @@ TEST(std_ranluxpp, distributions) {
   test_distributions<std::ranlux48>();
   test_distributions<ranluxpp>();
 }
+
+TEST(std_ranluxpp, word_engines) {
+  ranluxpp rng(1);
+  ranluxpp32 rng32(1);
+  ranluxpp64 rng64(1);
+
+  // The word engines slice the same blocks as the 48 bit numbers.
+  for (int b = 0; b < 3; b++) {
+    uint64_t bits[9] = {};
+    for (int i = 0; i < 12; i++) {
+      uint64_t number = rng();
+      int position = i * 48;
+      bits[position / 64] |= number << (position % 64);
+      if (position % 64 > 64 - 48) {
+        bits[position / 64 + 1] |= number >> (64 - position % 64);
+      }
+    }
+    for (int i = 0; i < 9; i++) {
+      EXPECT_EQ(rng64(), bits[i]);
+      EXPECT_EQ(rng32(), uint32_t(bits[i]));
+      EXPECT_EQ(rng32(), uint32_t(bits[i] >> 32));
+    }
+  }
+
+  static_assert(std::is_same<ranluxpp32::result_type, uint32_t>::value,
+                "32 bit words should have a 32 bit result_type");
+  EXPECT_EQ(ranluxpp32::max(), 0xffffffff);
+  EXPECT_EQ(ranluxpp64::max(), 0xffffffffffffffff);
+
+  // The constructor takes the same 64 bit seed as seed().
+  uint64_t large = (uint64_t(1) << 32) + 1;
+  ranluxpp32 constructed(large);
+  ranluxpp32 seeded;
+  seeded.seed(large);
+  EXPECT_EQ(constructed, seeded);
+  EXPECT_NE(constructed, ranluxpp32(1));
+}
+
+template <class Engine> void test_word_engine() {
+  // Discard within a block, to the end of a block, and across blocks.
+  for (unsigned long long z : {1, 7, 8, 9, 17, 18, 19, 100}) {
+    Engine rng(1);
+    Engine expected(1);
+    rng();
+    expected();
+    rng.discard(z);
+    for (unsigned long long i = 0; i < z; i++) {
+      expected();
+    }
+    EXPECT_EQ(rng, expected);
+    EXPECT_EQ(rng(), expected());
+  }
+
+  // Generate across block boundaries.
+  Engine rng(1);
+  Engine scalar(1);
+  std::vector<typename Engine::result_type> numbers(50);
+  rng.generate(numbers.data(), numbers.data() + numbers.size());
+  for (auto number : numbers) {
+    EXPECT_EQ(number, scalar());
+  }
+  EXPECT_EQ(rng, scalar);
+
+  // Stream output and input.
+  std::stringstream ss;
+  ss << rng;
+  Engine restored;
+  ss >> restored;
+  EXPECT_FALSE(ss.fail());
+  EXPECT_EQ(rng, restored);
+  EXPECT_EQ(rng(), restored());
+
+  test_distributions<Engine>();
+  std::uniform_int_distribution<uint32_t> uniform;
+  uniform(rng);
+}
+
+TEST(std_ranluxpp, word_engine32) { test_word_engine<ranluxpp32>(); }
+TEST(std_ranluxpp, word_engine64) { test_word_engine<ranluxpp64>(); }
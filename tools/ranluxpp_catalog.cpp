@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+
+// Command line tool to build and inspect catalogs of substream states, see
+// RanluxppCatalog.h for the file format.
+
+#include <RanluxppCatalog.h>
+
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+static void usage(const char *argv0) {
+  std::fprintf(stderr,
+               "Usage: %s build <file> <seed> <spacing> <first> <count>\n"
+               "       %s info <file>\n"
+               "       %s verify <file>\n",
+               argv0, argv0, argv0);
+}
+
+static bool parse(const char *str, uint64_t &value) {
+  char *end;
+  value = std::strtoull(str, &end, 0);
+  return *str != '\0' && *end == '\0';
+}
+
+int main(int argc, char *argv[]) {
+  if (argc < 3) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  const char *command = argv[1];
+  const char *path = argv[2];
+  if (std::strcmp(command, "build") == 0) {
+    uint64_t seed, spacing, first, count;
+    if (argc != 7 || !parse(argv[3], seed) || !parse(argv[4], spacing) ||
+        !parse(argv[5], first) || !parse(argv[6], count)) {
+      usage(argv[0]);
+      return 1;
+    }
+    if (!RanluxppCatalog::Build(path, seed, spacing, first, count)) {
+      std::fprintf(stderr, "%s: could not build catalog '%s'\n", argv[0],
+                   path);
+      return 1;
+    }
+    return 0;
+  }
+
+  if (argc != 3 ||
+      (std::strcmp(command, "info") != 0 &&
+       std::strcmp(command, "verify") != 0)) {
+    usage(argv[0]);
+    return 1;
+  }
+
+  RanluxppCatalog catalog(path);
+  if (!catalog.IsValid()) {
+    std::fprintf(stderr, "%s: '%s' is not a valid catalog\n", argv[0], path);
+    return 1;
+  }
+
+  if (std::strcmp(command, "info") == 0) {
+    std::printf("seed:    %" PRIu64 "\n", catalog.Seed());
+    std::printf("spacing: %" PRIu64 "\n", catalog.Spacing());
+    std::printf("first:   %" PRIu64 "\n", catalog.First());
+    std::printf("count:   %" PRIu64 "\n", catalog.Count());
+    return 0;
+  }
+
+  if (!catalog.Verify()) {
+    std::fprintf(stderr, "%s: checksum mismatch in '%s'\n", argv[0], path);
+    return 1;
+  }
+  return 0;
+}